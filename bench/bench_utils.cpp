@@ -0,0 +1,53 @@
+#include "bench_utils.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include "common.hpp"
+
+namespace WindGB::Bench {
+
+std::string make_rom(const size_t size, const uint8_t cartridge_type, const uint8_t ram_size) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "windgb_bench_%zu_%02X_%02X.gb", size, cartridge_type, ram_size);
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    if (std::filesystem::exists(path) && std::filesystem::file_size(path) == size) return path.string();
+
+    std::vector<uint8_t> rom(size, 0x00);
+    const char title[] = "WINDGB BENCH";
+    std::copy(std::begin(title), std::end(title) - 1, rom.begin() + CARTRIDGE_HEADER_TITLE);
+    rom[CARTRIDGE_HEADER_CARTRIDGE_TYPE] = cartridge_type;
+    rom[CARTRIDGE_HEADER_ROM_SIZE] = static_cast<uint8_t>(std::countr_zero(size / (32 * 1024)));  // 32 KiB << n
+    rom[CARTRIDGE_HEADER_RAM_SIZE] = ram_size;
+
+    uint8_t checksum = 0;
+    for (uint16_t address = CARTRIDGE_HEADER_TITLE; address <= CARTRIDGE_HEADER_MASK_ROM_VERSION; address++) {
+        checksum = checksum - rom[address] - 1;
+    }
+    rom[CARTRIDGE_HEADER_CHECKSUM] = checksum;
+
+    std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to write the benchmark ROM '" + path.string() + "'");
+    }
+    file.write(reinterpret_cast<const char*>(rom.data()), static_cast<std::streamsize>(rom.size()));
+    return path.string();
+}
+
+Machine::Machine(const uint8_t cartridge_type, const uint8_t ram_size, const size_t rom_size) {
+    cartridge.load(make_rom(rom_size, cartridge_type, ram_size));
+    gameboy.insert(&cartridge);
+    gameboy.init();
+
+    Bus& bus = gameboy.get_bus();
+    bus.write(0xFF50, 0x01);  // Unmap the boot ROM
+    bus.direct_write(REG_IE_ADDR, 0x00);
+    gameboy.get_cpu().regs().PC = 0x0100;
+}
+
+}  // namespace WindGB::Bench
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "windgb.hpp"
+
+namespace WindGB::Bench {
+
+// Path of a ROM image filled with NOPs and a valid header, written once into the temporary directory
+std::string make_rom(size_t size, uint8_t cartridge_type = 0x00, uint8_t ram_size = 0x00);
+
+// Machine running a generated ROM, with the boot ROM unmapped and every interrupt disabled so that the benchmarks only
+// run the code they set up. Heap allocated, a GameBoy is too large for the stack of the benchmark threads.
+struct Machine {
+    Cartridge cartridge;
+    GameBoy gameboy;
+
+    explicit Machine(uint8_t cartridge_type = 0x00, uint8_t ram_size = 0x00, size_t rom_size = 32 * 1024);
+};
+
+}  // namespace WindGB::Bench
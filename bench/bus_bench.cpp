@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <memory>
+
+#include "bench_utils.hpp"
+
+namespace WindGB::Bench {
+
+static constexpr uint8_t MBC1_RAM = 0x02;
+static constexpr uint8_t RAM_8_KIB = 0x02;
+
+// Cartridge with RAM enabled, so that every region of the map is backed
+static std::unique_ptr<Machine> make_bus_machine() {
+    auto machine = std::make_unique<Machine>(MBC1_RAM, RAM_8_KIB);
+    machine->gameboy.get_bus().write(0x0000, 0x0A);
+    return machine;
+}
+
+static void set_region_label(benchmark::State& state, const uint16_t addr) {
+    char label[48];
+    std::snprintf(label, sizeof(label), "%s 0x%04X", bus_region_name(bus_region(addr)), addr);
+    state.SetLabel(label);
+}
+
+// Timed read, ticking the bus one M-cycle
+static void BM_BusRead(benchmark::State& state) {
+    const auto addr = static_cast<uint16_t>(state.range(0));
+    const auto machine = make_bus_machine();
+    Bus& bus = machine->gameboy.get_bus();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bus.read(addr));
+    }
+    set_region_label(state, addr);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_BusRead)
+    ->Arg(0x0150)   // ROM bank 0
+    ->Arg(0x4000)   // ROM bank N
+    ->Arg(0x8000)   // VRAM
+    ->Arg(0xA000)   // External RAM
+    ->Arg(0xC000)   // WRAM
+    ->Arg(0xE000)   // Echo RAM
+    ->Arg(0xFE00)   // OAM
+    ->Arg(0xFF44)   // LY, syncs the PPU
+    ->Arg(0xFF80)   // HRAM
+    ->Arg(0xFFFF);  // IE
+
+// Timed write, ticking the bus one M-cycle. The ROM area is left to BM_BankSwitch.
+static void BM_BusWrite(benchmark::State& state) {
+    const auto addr = static_cast<uint16_t>(state.range(0));
+    const auto machine = make_bus_machine();
+    Bus& bus = machine->gameboy.get_bus();
+
+    uint8_t data = 0;
+    for (auto _ : state) {
+        bus.write(addr, data++);
+    }
+    set_region_label(state, addr);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_BusWrite)
+    ->Arg(0x8000)   // VRAM, syncs the PPU and invalidates the tile caches
+    ->Arg(0xA000)   // External RAM
+    ->Arg(0xC000)   // WRAM
+    ->Arg(0xE000)   // Echo RAM
+    ->Arg(0xFE00)   // OAM
+    ->Arg(0xFF42)   // SCY, syncs and reschedules the PPU
+    ->Arg(0xFF80)   // HRAM
+    ->Arg(0xFFFF);  // IE
+
+// Write to DMA, copying 160 bytes from WRAM to OAM
+static void BM_OamDma(benchmark::State& state) {
+    const auto machine = make_bus_machine();
+    Bus& bus = machine->gameboy.get_bus();
+
+    for (auto _ : state) {
+        bus.write(REG_DMA_ADDR, 0xC0);
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * 160);
+}
+BENCHMARK(BM_OamDma);
+
+// One M-cycle of the bus, the path every component update hangs off
+static void BM_BusTick(benchmark::State& state) {
+    const auto machine = make_bus_machine();
+    Bus& bus = machine->gameboy.get_bus();
+
+    for (auto _ : state) {
+        bus.cycles(1);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_BusTick);
+
+// TIMA read with the timer running at its fastest rate, the timer catches up with the elapsed M-cycles on every read
+static void BM_TimerSync(benchmark::State& state) {
+    const auto machine = make_bus_machine();
+    Bus& bus = machine->gameboy.get_bus();
+    bus.write(REG_TAC_ADDR, 0x05);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bus.read(REG_TIMA_ADDR));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_TimerSync);
+
+}  // namespace WindGB::Bench
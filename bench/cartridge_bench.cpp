@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bench_utils.hpp"
+
+namespace WindGB::Bench {
+
+static constexpr uint8_t MBC5 = 0x19;
+
+// ROM images from 32 KiB to 8 MiB
+static void BM_CartridgeLoad(benchmark::State& state) {
+    const auto size = static_cast<size_t>(state.range(0));
+    const std::string path = make_rom(size, size > 32 * 1024 ? MBC5 : 0x00);
+
+    for (auto _ : state) {
+        Cartridge cartridge;
+        cartridge.load(path);
+        benchmark::DoNotOptimize(cartridge.get_rom_hash());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_CartridgeLoad)->RangeMultiplier(4)->Range(32 * 1024, 8 * 1024 * 1024)->Unit(benchmark::kMillisecond);
+
+// Bank register write followed by a read of the switchable bank, on a 1 MiB ROM
+static void BM_BankSwitch(benchmark::State& state) {
+    const auto cartridge_type = static_cast<uint8_t>(state.range(0));
+    Cartridge cartridge;
+    cartridge.load(make_rom(1024 * 1024, cartridge_type));
+
+    uint8_t bank = 1;
+    for (auto _ : state) {
+        cartridge.write(0x2000, bank);
+        benchmark::DoNotOptimize(cartridge.read(0x4000));
+        bank = (bank % 63) + 1;
+    }
+    state.SetLabel(cartridge_type == MBC5 ? "MBC5" : "MBC1");
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_BankSwitch)->Arg(0x01)->Arg(MBC5);
+
+}  // namespace WindGB::Bench
@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <memory>
+
+#include "bench_utils.hpp"
+#include "instructions.hpp"
+
+namespace WindGB::Bench {
+
+static constexpr uint16_t CODE_ADDR = 0xC000;
+static constexpr uint16_t DATA_ADDR = 0xC100;
+
+// One CPU step of an opcode, 0x1XX for the CB prefixed ones. The code runs from WRAM and its operands point to data in
+// WRAM (n16 = 0xC100, n8 = e8 = 0), away from the code so that LD [n16] does not overwrite it. The registers are reset
+// before every step so that each one takes the same path.
+static void BM_Instruction(benchmark::State& state, const uint16_t opcode) {
+    const bool prefixed = opcode > 0xFF;
+    const std::array<uint8_t, 3> code = prefixed ? std::array<uint8_t, 3>{0xCB, static_cast<uint8_t>(opcode), 0x00}
+                                                 : std::array<uint8_t, 3>{static_cast<uint8_t>(opcode), DATA_ADDR & 0xFF, DATA_ADDR >> 8};
+
+    const auto machine = std::make_unique<Machine>();
+    Bus& bus = machine->gameboy.get_bus();
+    CPU& cpu = machine->gameboy.get_cpu();
+    for (uint16_t i = 0; i < code.size(); i++) bus.direct_write(CODE_ADDR + i, code[i]);
+
+    for (auto _ : state) {
+        cpu.regs().AF = 0x0100;
+        cpu.regs().BC = DATA_ADDR;
+        cpu.regs().DE = DATA_ADDR;
+        cpu.regs().HL = DATA_ADDR;
+        cpu.regs().SP = 0xDFF0;
+        cpu.regs().PC = CODE_ADDR;
+        benchmark::DoNotOptimize(cpu.step());
+    }
+
+    state.SetLabel(prefixed ? prefix_instruction_table[opcode & 0xFF].name : instruction_table[opcode].name);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+// Every opcode but HALT, which would stop the CPU, the invalid ones, which terminate the emulator, and the bare CB prefix.
+// Listed here rather than read from instruction_table, which may not be initialized yet.
+static constexpr std::array<uint8_t, 13> SKIPPED_OPCODES = {0x76, 0xCB, 0xD3, 0xDB, 0xDD, 0xE3, 0xE4, 0xEB, 0xEC, 0xED, 0xF4, 0xFC, 0xFD};
+
+static const bool INSTRUCTIONS_REGISTERED = [] {
+    for (uint16_t opcode = 0; opcode < 0x200; opcode++) {
+        if (opcode < 0x100 && std::ranges::find(SKIPPED_OPCODES, opcode) != SKIPPED_OPCODES.end()) continue;
+
+        char name[32];
+        std::snprintf(name, sizeof(name), opcode > 0xFF ? "BM_Instruction/CB_%02X" : "BM_Instruction/%02X", opcode & 0xFF);
+        benchmark::RegisterBenchmark(name, BM_Instruction, opcode);
+    }
+    return true;
+}();
+
+// A step while halted, the idle loop of most games
+static void BM_HaltedStep(benchmark::State& state) {
+    const auto machine = std::make_unique<Machine>();
+    Bus& bus = machine->gameboy.get_bus();
+    CPU& cpu = machine->gameboy.get_cpu();
+    bus.direct_write(CODE_ADDR, 0x76);
+    cpu.regs().PC = CODE_ADDR;
+    cpu.step();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cpu.step());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_HaltedStep);
+
+}  // namespace WindGB::Bench
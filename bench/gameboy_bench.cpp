@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+
+#include "bench_utils.hpp"
+
+namespace WindGB::Bench {
+
+static constexpr uint8_t MBC1_RAM = 0x02;
+
+// One machine step of a JR -2 loop in WRAM, the per-instruction cost of the emulation loop around the CPU
+static void BM_Step(benchmark::State& state) {
+    const auto machine = std::make_unique<Machine>();
+    GameBoy& gameboy = machine->gameboy;
+    gameboy.get_bus().direct_write(0xC000, 0x18);
+    gameboy.get_bus().direct_write(0xC001, 0xFE);
+    gameboy.get_cpu().regs().PC = 0xC000;
+    const GameBoy::Session session(gameboy);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(gameboy.step());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Step);
+
+// Clone of a running machine into a reused target, ROM only then MBC1 with 8 KiB and 32 KiB of RAM
+static void BM_Clone(benchmark::State& state) {
+    const auto ram_size = static_cast<uint8_t>(state.range(0));
+    const auto machine = std::make_unique<Machine>(ram_size ? MBC1_RAM : 0x00, ram_size);
+    for (int i = 0; i < 10000; i++) machine->gameboy.step();
+    const auto target = std::make_unique<GameBoy>(machine->gameboy);
+
+    for (auto _ : state) {
+        machine->gameboy.clone_into(*target);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_Clone)->Arg(0x00)->Arg(0x02)->Arg(0x03);
+
+// Incremental save into the same snapshot, after running the given number of instructions (not timed)
+static void BM_SnapshotSave(benchmark::State& state) {
+    const auto steps = state.range(0);
+    const auto machine = std::make_unique<Machine>(MBC1_RAM, 0x03);
+    for (int i = 0; i < 10000; i++) machine->gameboy.step();
+    Snapshot snapshot;
+    (void)machine->gameboy.save_snapshot(snapshot);
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        for (int64_t i = 0; i < steps; i++) machine->gameboy.step();
+        const auto start = std::chrono::steady_clock::now();
+        bytes += machine->gameboy.save_snapshot(snapshot);
+        state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_SnapshotSave)->Arg(0)->Arg(1000)->UseManualTime();
+
+// Rewind of a running machine to the snapshot saved from it, 1000 instructions later (not timed)
+static void BM_SnapshotRestore(benchmark::State& state) {
+    const auto machine = std::make_unique<Machine>(MBC1_RAM, 0x03);
+    for (int i = 0; i < 10000; i++) machine->gameboy.step();
+    Snapshot snapshot;
+    (void)machine->gameboy.save_snapshot(snapshot);
+
+    size_t bytes = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < 1000; i++) machine->gameboy.step();
+        const auto start = std::chrono::steady_clock::now();
+        bytes += machine->gameboy.restore_snapshot(snapshot);
+        state.SetIterationTime(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+BENCHMARK(BM_SnapshotRestore)->UseManualTime();
+
+}  // namespace WindGB::Bench
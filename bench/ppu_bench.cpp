@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "bench_utils.hpp"
+
+namespace WindGB {
+
+// Reaches the rendering steps the PPU keeps private
+struct PPUBenchmark {
+    static void set_line(PPU& ppu, const uint8_t line) { ppu.ly() = line; }
+    static void evaluate_sprites(PPU& ppu) { ppu.evaluate_sprites(); }
+    // Forgets the inputs the line was last drawn from, so that it is not skipped
+    static void invalidate_line(PPU& ppu) { ppu.line_fingerprints_[ppu.render_buffer_index()][ppu.ly()] = 0; }
+    static void render_scanline(PPU& ppu) { ppu.render_scanline(); }
+};
+
+}  // namespace WindGB
+
+namespace WindGB::Bench {
+
+static constexpr uint8_t LINE = 72;
+
+enum LineKind : uint8_t {
+    BG_ONLY = 0,
+    WINDOW,
+    SPRITES,
+    UNCHANGED,
+};
+
+// Tile data and maps filled with a fixed pseudo-random pattern, and 10 sprites crossing LINE
+static std::unique_ptr<Machine> make_ppu_machine(const LineKind kind) {
+    auto machine = std::make_unique<Machine>();
+    Bus& bus = machine->gameboy.get_bus();
+
+    uint32_t seed = 0x12345678;
+    for (uint16_t addr = 0x8000; addr < 0x9800; addr++) {
+        seed = seed * 1664525 + 1013904223;
+        bus.direct_write(addr, seed >> 24);
+    }
+    for (uint16_t addr = 0x9800; addr < 0xA000; addr++) bus.direct_write(addr, addr & 0xFF);
+
+    for (uint8_t i = 0; i < 10; i++) {
+        const uint16_t entry = OAM_ADDR_START + i * 4;
+        bus.direct_write(entry, LINE + 16 - 4);
+        bus.direct_write(entry + 1, 8 + i * 15);
+        bus.direct_write(entry + 2, i + 1);
+        bus.direct_write(entry + 3, (i & 1) << 5);
+    }
+
+    bus.direct_write(REG_BGP_ADDR, 0xE4);
+    bus.direct_write(REG_OBP0_ADDR, 0xE4);
+    bus.direct_write(REG_SCX_ADDR, 3);
+    bus.direct_write(REG_WY_ADDR, 0);
+    bus.direct_write(REG_WX_ADDR, 87);
+    switch (kind) {
+        case WINDOW:
+            bus.direct_write(REG_LCDC_ADDR, 0xF1);  // BG and window on the 0x9C00 map
+            break;
+        case SPRITES:
+            bus.direct_write(REG_LCDC_ADDR, 0x93);  // BG and 8x8 sprites
+            break;
+        default:
+            bus.direct_write(REG_LCDC_ADDR, 0x91);  // BG only
+            break;
+    }
+
+    PPU& ppu = machine->gameboy.get_ppu();
+    PPUBenchmark::set_line(ppu, LINE);
+    PPUBenchmark::evaluate_sprites(ppu);
+    return machine;
+}
+
+// One scanline drawn by the scanline engine
+static void BM_RenderScanline(benchmark::State& state) {
+    const auto kind = static_cast<LineKind>(state.range(0));
+    const auto machine = make_ppu_machine(kind);
+    PPU& ppu = machine->gameboy.get_ppu();
+
+    for (auto _ : state) {
+        if (kind != UNCHANGED) PPUBenchmark::invalidate_line(ppu);
+        PPUBenchmark::render_scanline(ppu);
+    }
+
+    constexpr const char* LABELS[] = {"BG only", "BG and window", "BG and 10 sprites", "Unchanged, skipped"};
+    state.SetLabel(LABELS[kind]);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * SCREEN_WIDTH);
+}
+BENCHMARK(BM_RenderScanline)->DenseRange(BG_ONLY, UNCHANGED);
+
+// Sprite selection of a line, from the cached index or with OAM written since the last line
+static void BM_EvaluateSprites(benchmark::State& state) {
+    const bool oam_written = state.range(0) != 0;
+    const auto machine = make_ppu_machine(SPRITES);
+    Bus& bus = machine->gameboy.get_bus();
+    PPU& ppu = machine->gameboy.get_ppu();
+
+    uint8_t x = 0;
+    for (auto _ : state) {
+        if (oam_written) bus.direct_write(OAM_ADDR_START + 1, x++);
+        PPUBenchmark::evaluate_sprites(ppu);
+    }
+    state.SetLabel(oam_written ? "OAM written" : "Cached");
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_EvaluateSprites)->Arg(0)->Arg(1);
+
+}  // namespace WindGB::Bench
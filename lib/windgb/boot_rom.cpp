@@ -0,0 +1,82 @@
+#include "boot_rom.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "bus.hpp"
+#include "common.hpp"
+
+namespace WindGB {
+
+// clang-format off
+// DMG values. LY and STAT follow the PPU, which starts a new frame, and DIV is set through the timer.
+static constexpr std::pair<uint16_t, uint8_t> POST_BOOT_REGISTERS[] = {
+    {REG_JOYP_ADDR, 0xCF}, {REG_SB_ADDR, 0x00}, {REG_SC_ADDR, 0x7E}, {REG_TIMA_ADDR, 0x00}, {REG_TMA_ADDR, 0x00}, {REG_TAC_ADDR, 0xF8},
+    {REG_IF_ADDR, 0xE1},
+    {REG_NR10_ADDR, 0x80}, {REG_NR11_ADDR, 0xBF}, {REG_NR12_ADDR, 0xF3}, {REG_NR13_ADDR, 0xFF}, {REG_NR14_ADDR, 0xBF},
+    {REG_NR21_ADDR, 0x3F}, {REG_NR22_ADDR, 0x00}, {REG_NR23_ADDR, 0xFF}, {REG_NR24_ADDR, 0xBF},
+    {REG_NR30_ADDR, 0x7F}, {REG_NR31_ADDR, 0xFF}, {REG_NR32_ADDR, 0x9F}, {REG_NR33_ADDR, 0xFF}, {REG_NR34_ADDR, 0xBF},
+    {REG_NR41_ADDR, 0xFF}, {REG_NR42_ADDR, 0x00}, {REG_NR43_ADDR, 0x00}, {REG_NR44_ADDR, 0xBF},
+    {REG_NR50_ADDR, 0x77}, {REG_NR51_ADDR, 0xF3}, {REG_NR52_ADDR, 0xF1},
+    {REG_LCDC_ADDR, 0x91}, {REG_SCY_ADDR, 0x00}, {REG_SCX_ADDR, 0x00}, {REG_LYC_ADDR, 0x00}, {REG_DMA_ADDR, 0xFF}, {REG_BGP_ADDR, 0xFC},
+    {REG_WY_ADDR, 0x00}, {REG_WX_ADDR, 0x00}, {REG_IE_ADDR, 0x00},
+};
+// clang-format on
+
+static constexpr std::array<uint8_t, 8> REGISTERED_MARK = {0x3C, 0x42, 0xB9, 0xA5, 0xB9, 0xA5, 0x42, 0x3C};  // ® tile, one bit plane
+static constexpr uint16_t LOGO_TILES_ADDR = 0x8010;                                                          // Tiles 0x01 to 0x18
+static constexpr uint16_t REGISTERED_MARK_ADDR = 0x8190;                                                     // Tile 0x19
+static constexpr uint8_t LOGO_LENGTH = 48;
+
+BootRom load_boot_rom(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::in);
+    if (!file) {
+        throw std::runtime_error("Unable to open the boot ROM '" + path + "'");
+    }
+
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    BootRom boot_rom;
+    if (data.size() != boot_rom.size()) {
+        throw std::runtime_error("The boot ROM '" + path + "' is " + std::to_string(data.size()) + " bytes long instead of 256");
+    }
+    std::ranges::copy(data, boot_rom.begin());
+    return boot_rom;
+}
+
+// Each pixel of a 4 pixels nibble is doubled into a row of 8
+static uint8_t scale_nibble(const uint8_t nibble) {
+    uint8_t row = 0;
+    for (int bit = 3; bit >= 0; bit--) row = (row << 2) | (((nibble >> bit) & 1) * 0b11);
+    return row;
+}
+
+void write_post_boot_state(Bus& bus) {
+    bus.unmap_boot_rom();
+    for (const auto& [addr, value] : POST_BOOT_REGISTERS) bus.direct_write(addr, value);
+
+    // Every nibble of the header logo becomes a row of 8 pixels, drawn twice, in the first bit plane
+    uint16_t addr = LOGO_TILES_ADDR;
+    for (uint16_t i = 0; i < LOGO_LENGTH; i++) {
+        const uint8_t data = bus.direct_read(CARTRIDGE_HEADER_NINTENDO_LOGO + i);
+        for (const uint8_t nibble : {data >> 4, data & 0x0F}) {
+            const uint8_t row = scale_nibble(nibble);
+            bus.direct_write(addr, row);
+            bus.direct_write(addr + 2, row);
+            addr += 4;
+        }
+    }
+    for (uint16_t i = 0; i < REGISTERED_MARK.size(); i++) bus.direct_write(REGISTERED_MARK_ADDR + i * 2, REGISTERED_MARK[i]);
+
+    // Two rows of 12 tiles centered on the screen, the ® at the end of the first one
+    for (uint8_t tile = 0; tile < 12; tile++) {
+        bus.direct_write(0x9904 + tile, tile + 0x01);
+        bus.direct_write(0x9924 + tile, tile + 0x0D);
+    }
+    bus.direct_write(0x9910, 0x19);
+}
+
+}  // namespace WindGB
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace WindGB {
+
+class Bus;
+
+// Mapped over the cartridge at 0x0000-0x00FF until 0xFF50 is written
+using BootRom = std::array<uint8_t, 0x100>;
+
+// Boot ROM built into the library, generated by CMake from WINDGB_BOOT_ROM (boot_rom.bin by default)
+extern const BootRom EMBEDDED_BOOT_ROM;
+
+// Reads a 256 bytes boot ROM dump
+BootRom load_boot_rom(const std::string& path);
+
+enum class BootMode : uint8_t {
+    BOOT_ROM = 0,  // Power on through the boot ROM
+    SKIP = 1,      // Start at the cartridge entry point, in the state the boot ROM leaves the machine in
+};
+
+// Internal DIV counter when the DMG boot ROM jumps to the cartridge
+constexpr uint16_t POST_BOOT_DIV_COUNTER = 0xABCC;
+
+// Writes the IO registers and the logo tiles and map the DMG boot ROM leaves behind (Pan Docs, Power Up Sequence).
+// The cartridge has to be linked, the logo is decoded from its header.
+void write_post_boot_state(Bus& bus);
+
+}  // namespace WindGB
@@ -2,55 +2,94 @@
 
 #include <algorithm>
 #include <cstdint>
-#include <fstream>
+#include <sstream>
+#include <stdexcept>
 
+#include "cartridge.hpp"
 #include "common.hpp"
+#include "hash.hpp"
 #include "logger.hpp"
+#include "trace.hpp"
 #include "utils.hpp"
 
 namespace WindGB {
 
-Bus::Bus() {
-    std::string boot_rom_path = PROJECT_SRC + std::string("/boot_rom.bin");
-    std::ifstream file(boot_rom_path, std::ios::binary | std::ios::in);
-    if (!file) {
-        throw std::runtime_error("Unable to open the ROM \'" + boot_rom_path + "\'");
-    }
+uint64_t Bus::hash_state() const {
+    const MachineState& state = *state_;
+    const uint64_t dma = state.dma_active | (state.dma_cycles_remaining << 8) | (state.dma_src_addr << 16) | (static_cast<uint64_t>(state.ie) << 32) |
+                         (static_cast<uint64_t>(state.boot_rom_enabled) << 40);
+    return hash_combine(state.tick, dma);
+}
 
-    // Read file into the memory
-    char byte;
-    int i = 0;
-    while (file.read(&byte, 1)) {
-        boot_rom_[i] = static_cast<uint8_t>(byte);
-        i++;
-    }
+PerfCounters Bus::snapshot_counters() const {
+    PerfCounters counters = counters_;
+    counters.m_cycles = state_->tick;
+    return counters;
+}
 
-    if (!file.eof()) {
-        throw std::runtime_error("Boot ROM read failed");
-    }
+uint16_t Bus::get_rom_bank(const uint16_t addr) const {
+    if (addr >= 0x8000) return NO_BANK;
+    if (addr < 0x4000) return 0;
+    return p_cartridge_ ? p_cartridge_->get_rom_bank() : NO_BANK;
 }
 
-void Bus::link(Component* component, uint16_t start_addr, uint16_t end_addr, const std::string& name, uint16_t offset) {
-    regions_.push_back({start_addr, end_addr, offset, component, name});
+void Bus::link(Component* component, uint16_t start_addr, uint16_t end_addr, const char* name, uint16_t offset) {
+    if (region_count_ == MAX_REGIONS) {
+        throw std::length_error("Too many memory regions linked to the bus");
+    }
+    regions_[region_count_++] = {start_addr, end_addr, offset, component, name};
 
     // Try to recover IO class (for joypad udpate)
     io_ = dynamic_cast<IO*>(component);
 
-    LOG_INFO("Linked {} at 0x{:04X}-0x{:04X}", regions_.back().name, start_addr, end_addr);
-    std::ranges::sort(regions_, [](const auto& a, const auto& b) { return a.start < b.start; });
+#ifdef WINDGB_MEMORY_STATS
+    memory_stats_.add_region(name, start_addr, end_addr);
+#endif
+
+    LOG_INFO("Linked {} at 0x{:04X}-0x{:04X}", name, start_addr, end_addr);
+    std::ranges::sort(regions(), [](const auto& a, const auto& b) { return a.start < b.start; });
+}
+
+void Bus::replace_component(const Component* component, Component* replacement) {
+    for (auto& region : regions()) {
+        if (region.component == component) region.component = replacement;
+    }
+    if (io_ == component) io_ = dynamic_cast<IO*>(replacement);
 }
 
-uint8_t Bus::direct_read(uint16_t addr) const {
+uint8_t Bus::direct_read(const uint16_t addr) {
+#ifdef WINDGB_MEMORY_STATS
+    memory_stats_.count(MemoryAccess::DIRECT_READ, addr);
+#endif
+    return read_mapped(addr);
+}
+
+uint8_t Bus::peek(const uint16_t addr) const {
     if (addr >= 0xFEA0 && addr <= 0xFEFF) return 0xFF;  // Prohibited
-    if (addr == REG_IE_ADDR) return ie_reg_;
+    if (addr == REG_IE_ADDR) return state_->ie;
+    const MemoryRegion* region = find_region(addr);
+    return region ? region->component->read(addr - region->offset) : 0xFF;
+}
 
-    for (const auto& region : regions_) {
+uint8_t Bus::read_mapped(const uint16_t addr) {
+    if (addr >= 0xFEA0 && addr <= 0xFEFF) return 0xFF;  // Prohibited
+    if (addr == REG_IE_ADDR) return state_->ie;
+    if (addr == REG_DIV_ADDR || addr == REG_TIMA_ADDR) {  // The timer is only brought up to date when observed
+        assert(p_timer_);
+        p_timer_->sync();
+    }
+    if (addr == REG_LY_ADDR || addr == REG_STAT_ADDR) {  // Same for the PPU
+        assert(p_ppu_);
+        p_ppu_->sync();
+    }
+
+    for (const auto& region : regions()) {
         if (region.contains(addr)) {
             return region.component->read(addr - region.offset);
         }
     }
 
-    LOG_WARN("Unmapped read at 0x{:04X}", addr);
+    LOG_WARN_LIMITED("Unmapped read at 0x{:04X}", addr);
     return 0xFF;  // Open bus
 }
 
@@ -59,49 +98,82 @@ void Bus::direct_write(uint16_t addr, uint8_t data) {
         return;
     }
     if (addr == REG_IE_ADDR) {
-        ie_reg_ = data;
+        state_->ie = data;
         return;
     }
-    if (addr == REG_DIV_ADDR) {
+    if (addr >= REG_DIV_ADDR && addr <= REG_TAC_ADDR) {
         assert(p_timer_);
-        p_timer_->reset_counter();
+        p_timer_->write(addr, data);
         return;
     }
 
-    for (const auto& region : regions_) {
+    const bool lcd_reg = addr >= REG_LCDC_ADDR && addr <= REG_WX_ADDR;
+    if (lcd_reg || is_ppu_memory(addr)) {  // Let the PPU catch up with the old values before changing them
+        assert(p_ppu_);
+        p_ppu_->sync();
+    }
+
+    for (const auto& region : regions()) {
         if (region.contains(addr)) {
             region.component->write(addr - region.offset, data);
+            if (lcd_reg) p_ppu_->reschedule();
             return;
         }
     }
 
-    LOG_WARN("Unmapped write at 0x{:04X} = 0x{:02X}", addr, data);
+    LOG_WARN_LIMITED("Unmapped write at 0x{:04X} = 0x{:02X}", addr, data);
 }
 
 uint8_t Bus::read(const uint16_t addr) {
+#ifdef WINDGB_MEMORY_STATS
+    memory_stats_.count(MemoryAccess::READ, addr);
+#endif
+    counters_.bus_accesses[static_cast<size_t>(bus_region(addr))]++;
+    return read_cycle(addr);
+}
+
+uint8_t Bus::fetch(const uint16_t addr) {
+#ifdef WINDGB_MEMORY_STATS
+    memory_stats_.count(MemoryAccess::FETCH, addr);
+#endif
+    counters_.bus_accesses[static_cast<size_t>(bus_region(addr))]++;
+    return read_cycle(addr);
+}
+
+uint8_t Bus::read_cycle(const uint16_t addr) {
     cycles(1);
-    if (is_dma_restricted_area(addr) && dma_active_) {
+    if (state_->dma_active && is_dma_restricted_area(addr)) {
         return 0xFF;
     }
-    if (boot_rom_enabled_ && addr < 0x0100) {
+    if (state_->boot_rom_enabled && addr < 0x0100) {
         return boot_rom_[addr];
     }
-    const uint8_t data = direct_read(addr);
+    const uint8_t data = read_mapped(addr);
     return data;
 }
 
 void Bus::write(const uint16_t addr, const uint8_t data) {
+#ifdef WINDGB_MEMORY_STATS
+    memory_stats_.count(MemoryAccess::WRITE, addr);
+#endif
+    counters_.bus_accesses[static_cast<size_t>(bus_region(addr))]++;
     cycles(1);
-    if (is_dma_restricted_area(addr) && dma_active_) {
+    if (state_->dma_active && is_dma_restricted_area(addr)) {
         return;
     }
     if (addr == 0xFF50) {
-        boot_rom_enabled_ = false;
+        state_->boot_rom_enabled = false;
         return;
     }
     if (addr == 0xFF46) {
         start_dma_transfer(data);
     }
+    if (addr < 0x8000) {  // MBC register, only the switches of the bank at 0x4000-0x7FFF are counted
+        const uint16_t bank = get_rom_bank(0x4000);
+        direct_write(addr, data);
+        if (get_rom_bank(0x4000) != bank) counters_.rom_bank_switches++;
+        return;
+    }
 
     direct_write(addr, data);
 }
@@ -111,24 +183,21 @@ void Bus::cycles(const uint8_t count) {
     assert(p_timer_);
     assert(io_);
     for (size_t i = 0; i < count; i++) {
-        tick_++;
-        if (dma_active_ && dma_cycles_remaining_ > 0) {
-            const uint8_t byte = direct_read(dma_src_addr_ + 160 - dma_cycles_remaining_);
-            direct_write(0xFE00 + 160 - dma_cycles_remaining_, byte);
-            dma_cycles_remaining_--;
-            if (dma_cycles_remaining_ <= 0) {
-                dma_active_ = false;
-                dma_src_addr_ = 0;
-            }
+        state_->tick++;
+        if (state_->dma_active && --state_->dma_cycles_remaining == 0) {  // The transfer itself is already done, only the bus lock remains
+            state_->dma_active = false;
+            state_->dma_src_addr = 0;
+        }
+        if (state_->tick >= state_->timer_next_event) {
+            p_timer_->sync();
         }
-        for (size_t tcycle = 0; tcycle < 4; tcycle++) {  // 4 T-cycles per M-cycles
-            if (io_->get_joypad()->is_button_released()) {
-                uint8_t if_reg = io_->read(REG_IF_ADDR);
-                if_reg |= (1 << 4);
-                io_->write(REG_IF_ADDR, if_reg);
-            }
-            p_timer_->tick();
-            p_ppu_->tick();
+        if (state_->tick >= state_->ppu_next_event) {
+            p_ppu_->sync();
+        }
+        if (io_->get_joypad()->is_button_released()) {
+            uint8_t if_reg = io_->read(REG_IF_ADDR);
+            if_reg |= (1 << 4);
+            io_->write(REG_IF_ADDR, if_reg);
         }
     }
 }
@@ -136,7 +205,7 @@ void Bus::cycles(const uint8_t count) {
 std::string Bus::memap_to_string() const {
     std::ostringstream oss;
     oss << "Memory Map:\n";
-    for (const auto& region : regions_) {
+    for (const auto& region : regions()) {
         oss << "\t" << to_hex4(region.start) << "-" << to_hex4(region.end) << ": " << region.name << "\n";
     }
 
@@ -144,9 +213,36 @@ std::string Bus::memap_to_string() const {
 }
 
 void Bus::start_dma_transfer(const uint8_t data) {
-    dma_active_ = true;
-    dma_cycles_remaining_ = 160;
-    dma_src_addr_ = data * 0x100;
+    TRACE_SCOPE("OAM DMA");
+    counters_.dma_transfers++;
+    state_->dma_active = true;
+    state_->dma_cycles_remaining = DMA_LENGTH;
+    state_->dma_src_addr = data * 0x100;
+
+    // Copy the whole page at once, the CPU is kept away from the bus by the DMA flag for the next 160 M-cycles
+    assert(p_ppu_);
+    p_ppu_->sync();
+    const MemoryRegion* src = find_region(state_->dma_src_addr);
+    const MemoryRegion* dst = find_region(OAM_ADDR_START);
+    assert(dst);
+    for (uint16_t i = 0; i < DMA_LENGTH; i++) {
+        const uint16_t src_addr = state_->dma_src_addr + i;
+        const uint8_t byte = (src && src->contains(src_addr)) ? src->component->read(src_addr - src->offset) : read_mapped(src_addr);
+        dst->component->write(OAM_ADDR_START + i - dst->offset, byte);
+    }
+}
+
+const Bus::MemoryRegion* Bus::find_region(const uint16_t addr) const {
+    for (const auto& region : regions()) {
+        if (region.contains(addr)) {
+            return &region;
+        }
+    }
+    return nullptr;
+}
+
+bool Bus::is_ppu_memory(const uint16_t addr) {
+    return (addr >= VRAM_ADDR_START && addr <= VRAM_ADDR_END) || (addr >= OAM_ADDR_START && addr <= OAM_ADDR_END);
 }
 
 bool Bus::is_dma_restricted_area(const uint16_t addr) const { return (addr >= 0x8000 && addr <= 0xFDFF) && !(addr >= 0xFF80 && addr <= 0xFFFE); }
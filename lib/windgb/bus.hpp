@@ -1,58 +1,117 @@
 #pragma once
 
+#include <array>
+#include <span>
 #include <string>
-#include <vector>
 
+#include "boot_rom.hpp"
 #include "component.hpp"
 #include "io.hpp"
+#include "machine_state.hpp"
+#include "memory_stats.hpp"
+#include "perf_counters.hpp"
 #include "ppu.hpp"
+#include "seqlock.hpp"
 #include "timer.hpp"
 
 namespace WindGB {
 
+class Cartridge;
+
 class Bus {
    public:
-    Bus();
-    void link(Component* component, uint16_t start_addr, uint16_t end_addr, const std::string& name = "", uint16_t offset = 0);
+    explicit Bus(MachineState& state) : state_(&state) {}
+
+    // Maps the component over the address range, name must outlive the bus
+    void link(Component* component, uint16_t start_addr, uint16_t end_addr, const char* name = "", uint16_t offset = 0);
 
-    [[nodiscard]] uint8_t direct_read(uint16_t addr) const;
+    // Emulator side read bypassing the bus timing. Brings the timer and the PPU up to date first when reading their
+    // registers, which moves their state forward.
+    [[nodiscard]] uint8_t direct_read(uint16_t addr);
+    // Same without any side effect, for debuggers and profilers. DIV, TIMA, STAT and LY may lag behind.
+    [[nodiscard]] uint8_t peek(uint16_t addr) const;
     void direct_write(uint16_t addr, uint8_t data);
     [[nodiscard]] uint8_t read(uint16_t addr);
+    // Same as read for the instruction stream, told apart in the memory statistics
+    [[nodiscard]] uint8_t fetch(uint16_t addr);
     void write(uint16_t addr, uint8_t data);
     void cycles(uint8_t count);
 
     void link_ppu(PPU* ppu) { p_ppu_ = ppu; }
     void link_timer(Timer* timer) { p_timer_ = timer; }
+    void link_cartridge(Cartridge* cartridge) { p_cartridge_ = cartridge; }
+    void link_state(MachineState& state) { state_ = &state; }
+    // Maps the replacement wherever the component is linked, used to point a copied bus to the components of its machine
+    void replace_component(const Component* component, Component* replacement);
+
+    void set_boot_rom(const BootRom& boot_rom) { boot_rom_ = boot_rom; }
+    // Same as the write to 0xFF50 that ends the boot ROM
+    void unmap_boot_rom() { state_->boot_rom_enabled = false; }
+
+    // ROM bank the address is read from, NO_BANK outside of the cartridge ROM
+    static constexpr uint16_t NO_BANK = 0xFFFF;
+    [[nodiscard]] uint16_t get_rom_bank(uint16_t addr) const;
 
-    uint64_t get_tick() const { return tick_; }
+    uint64_t get_tick() const { return state_->tick; }
+
+    // Incremented by the components on the emulation thread
+    [[nodiscard]] PerfCounters& get_counters() { return counters_; }
+    // Up to date counters, emulation thread only
+    [[nodiscard]] PerfCounters snapshot_counters() const;
+    // Makes the current counters visible to get_published_counters, called when a frame is presented
+    void publish_counters() { published_counters_.store(snapshot_counters()); }
+    // Counters as of the last presented frame, from any thread
+    [[nodiscard]] PerfCounters get_published_counters() const { return published_counters_.load(); }
+    // Brings the counters back to the ones of a snapshot
+    void restore_counters(const PerfCounters& counters, const PerfCounters& published) {
+        counters_ = counters;
+        published_counters_.store(published);
+    }
+    [[nodiscard]] uint64_t hash_state() const;
 
     [[nodiscard]] std::string memap_to_string() const;
 
+#ifdef WINDGB_MEMORY_STATS
+    [[nodiscard]] const MemoryStats& get_memory_stats() const { return memory_stats_; }
+    void reset_memory_stats() { memory_stats_.reset(); }
+#endif
+
    private:
     struct MemoryRegion {
         uint16_t start;
         uint16_t end;
         uint16_t offset;
         Component* component;
-        std::string name;
+        const char* name;
 
         [[nodiscard]] bool contains(uint16_t address) const { return address >= start && address <= end; }
     };
 
-    std::vector<MemoryRegion> regions_;
-    uint8_t ie_reg_ = 0;
-    uint64_t tick_ = 0;
-    std::array<uint8_t, 256> boot_rom_;
-    bool boot_rom_enabled_ = true;
+    static constexpr uint8_t DMA_LENGTH = 160;
+    static constexpr size_t MAX_REGIONS = 16;
+
+    MachineState* state_;
+    std::array<MemoryRegion, MAX_REGIONS> regions_{};  // Fixed size, a copy of the bus does not allocate
+    uint8_t region_count_ = 0;
+    BootRom boot_rom_ = EMBEDDED_BOOT_ROM;
     PPU* p_ppu_ = nullptr;
     Timer* p_timer_ = nullptr;
-    bool dma_active_ = false;
-    uint8_t dma_cycles_remaining_ = 0;
-    uint16_t dma_src_addr_ = 0;
+    Cartridge* p_cartridge_ = nullptr;
     IO* io_ = nullptr;
+    PerfCounters counters_;
+    SeqLock<PerfCounters> published_counters_;
+#ifdef WINDGB_MEMORY_STATS
+    MemoryStats memory_stats_;
+#endif
 
+    [[nodiscard]] std::span<const MemoryRegion> regions() const { return {regions_.data(), region_count_}; }
+    [[nodiscard]] std::span<MemoryRegion> regions() { return {regions_.data(), region_count_}; }
+    [[nodiscard]] uint8_t read_mapped(uint16_t addr);
+    [[nodiscard]] uint8_t read_cycle(uint16_t addr);
+    [[nodiscard]] const MemoryRegion* find_region(uint16_t addr) const;
     void start_dma_transfer(uint8_t data);
     [[nodiscard]] bool is_dma_restricted_area(uint16_t addr) const;
+    [[nodiscard]] static bool is_ppu_memory(uint16_t addr);
 };
 
 }  // namespace WindGB
\ No newline at end of file
@@ -8,6 +8,7 @@
 #include <unordered_map>
 
 #include "common.hpp"
+#include "hash.hpp"
 #include "logger.hpp"
 #include "mbc/mbc1.hpp"
 
@@ -106,6 +107,25 @@ static const std::unordered_map<uint8_t, std::string> LICENSE_CODES = {
 };
 // clang-format on
 
+Cartridge::Cartridge(const Cartridge& other) { *this = other; }
+
+Cartridge& Cartridge::operator=(const Cartridge& other) {
+    copy_from(other, nullptr);
+    return *this;
+}
+
+size_t Cartridge::copy_from(const Cartridge& other, const MBC::RamPages::Bitmap* pages) {
+    if (this == &other) return 0;
+    header_ = other.header_;
+    data_ = other.data_;
+    rom_hash_ = other.rom_hash_;
+    if (!other.p_mbc_) {
+        p_mbc_.reset();
+        return 0;
+    }
+    return other.p_mbc_->copy_to(p_mbc_, pages);
+}
+
 void Cartridge::load(const std::string& rom_path) {
     std::ifstream file(rom_path, std::ios::binary | std::ios::in);
     if (!file) {
@@ -113,17 +133,19 @@ void Cartridge::load(const std::string& rom_path) {
     }
 
     // Read file into the memory
+    auto rom = std::make_shared<std::vector<uint8_t>>();
     char byte;
     while (file.read(&byte, 1)) {
-        data_.push_back(static_cast<uint8_t>(byte));
+        rom->push_back(static_cast<uint8_t>(byte));
     }
 
     if (!file.eof()) {
-        data_.clear();
         throw std::runtime_error("ROM read failed");
     }
 
-    header_ = reinterpret_cast<CartridgeHeader*>(data_.data() + CARTRIDGE_HEADER_ENTRY_POINT);
+    data_ = std::move(rom);
+    header_ = reinterpret_cast<const CartridgeHeader*>(data_->data() + CARTRIDGE_HEADER_ENTRY_POINT);
+    rom_hash_ = hash_bytes(data_->data(), data_->size());
 
     // MBC
     p_mbc_ = MBC::create(data_, header_->cart_type, header_->ram_size);
@@ -131,7 +153,7 @@ void Cartridge::load(const std::string& rom_path) {
     // Checksum
     uint8_t checksum = 0;
     for (uint16_t address = CARTRIDGE_HEADER_TITLE; address <= CARTRIDGE_HEADER_MASK_ROM_VERSION; address++) {
-        checksum = checksum - data_[address] - 1;
+        checksum = checksum - (*data_)[address] - 1;
     }
 
     LOG_INFO("Cartridge loaded:");
@@ -148,7 +170,7 @@ uint8_t Cartridge::read(const uint16_t addr) const {
     if (p_mbc_) {
         return p_mbc_->read(addr);
     }
-    return data_[addr];
+    return (*data_)[addr];
 }
 
 void Cartridge::write(const uint16_t addr, const uint8_t data) {
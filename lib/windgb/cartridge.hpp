@@ -27,18 +27,31 @@ struct CartridgeHeader {
 
 class Cartridge : public Component {
    public:
+    Cartridge() = default;
+    // Copies share the ROM, the MBC state and RAM are duplicated
+    Cartridge(const Cartridge& other);
+    Cartridge& operator=(const Cartridge& other);
+    // Same as the copy assignment, only the RAM pages set in pages are copied when given. Returns the bytes of RAM copied.
+    size_t copy_from(const Cartridge& other, const MBC::RamPages::Bitmap* pages);
+
     void load(const std::string& rom_path);
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
 
-    [[nodiscard]] CartridgeHeader* get_header() const { return header_; }
+    [[nodiscard]] const CartridgeHeader* get_header() const { return header_; }
+    [[nodiscard]] std::string get_title() const;
+    [[nodiscard]] uint64_t get_rom_hash() const { return rom_hash_; }
+    [[nodiscard]] uint16_t get_rom_bank() const { return p_mbc_ ? p_mbc_->get_rom_bank() : 1; }
+    [[nodiscard]] uint64_t hash_state() const { return p_mbc_ ? p_mbc_->hash_state() : 0; }
+    // nullptr for the ROM only cartridges
+    [[nodiscard]] MBC* get_mbc() const { return p_mbc_.get(); }
 
    private:
-    CartridgeHeader* header_ = nullptr;
-    std::vector<uint8_t> data_;
+    const CartridgeHeader* header_ = nullptr;
+    RomData data_;
+    uint64_t rom_hash_ = 0;
     std::unique_ptr<MBC> p_mbc_;
 
-    [[nodiscard]] std::string get_title() const;
     [[nodiscard]] std::string get_cart_type() const;
     [[nodiscard]] std::string get_lic_name() const;
 };
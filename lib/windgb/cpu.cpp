@@ -5,6 +5,7 @@
 #include <iostream>
 
 #include "bus.hpp"
+#include "hash.hpp"
 #include "instructions.hpp"
 #include "interrupt.hpp"
 #include "logger.hpp"
@@ -13,50 +14,92 @@ namespace WindGB {
 
 static std::array<uint16_t, 5> INTERRUPT_VECTOR = {0x0040, 0x0048, 0x0050, 0x0058, 0x0060};
 
-CPU::CPU(Bus& bus, IO& io) : bus_(bus), interrupt_handler_(bus, io) {}
+CPU::CPU(Bus& bus, MachineState& state, FlightRecorder& flight_recorder)
+    : bus_(&bus), state_(&state), interrupt_handler_(state), flight_recorder_(&flight_recorder) {}
+
+void CPU::link(Bus& bus, MachineState& state, FlightRecorder& flight_recorder) {
+    bus_ = &bus;
+    state_ = &state;
+    interrupt_handler_.link(state);
+    flight_recorder_ = &flight_recorder;
+}
 
 void CPU::init() {
-    regs.A = 0x01;
-    regs.F = 0xB0;
-    regs.B = 0x00;
-    regs.C = 0x13;
-    regs.D = 0x00;
-    regs.E = 0xD8;
-    regs.H = 0x01;
-    regs.L = 0x4D;
-    regs.SP = 0xFFFE;
-    regs.PC = 0x0000;  // Jump to the boot rom entry point
-
-    interrupt_handler_.ime = false;
-    request_ime_en_ = false;
-    halted_ = false;
+    regs().A = 0x01;
+    regs().F = 0xB0;
+    regs().B = 0x00;
+    regs().C = 0x13;
+    regs().D = 0x00;
+    regs().E = 0xD8;
+    regs().H = 0x01;
+    regs().L = 0x4D;
+    regs().SP = 0xFFFE;
+    regs().PC = 0x0000;  // Jump to the boot rom entry point
+
+    interrupt_handler_.set_ime(false);
+    state_->request_ime_en = false;
+    state_->halted = false;
 
     LOG_INFO("CPU initialized");
 }
 
+uint64_t CPU::hash_state() const {
+    const uint64_t registers = regs().AF | (regs().BC << 16) | (static_cast<uint64_t>(regs().DE) << 32) | (static_cast<uint64_t>(regs().HL) << 48);
+    const uint64_t flags = interrupt_handler_.ime() | (state_->request_ime_en << 1) | (state_->halted << 2) | (state_->halt_bug << 3);
+    return hash_combine(hash_combine(registers, regs().SP | (regs().PC << 16)), flags);
+}
+
 uint32_t CPU::step() {
-    const uint64_t last_tick = bus_.get_tick();
+    if (profiler_) return profile_step();
+    return execute_step();
+}
 
-    if (halted_) {
+uint32_t CPU::profile_step() {
+    const uint16_t pc = regs().PC;
+    const uint16_t sp = regs().SP;
+    const uint16_t bank = bus_->get_rom_bank(pc);
+    const uint8_t opcode = bus_->peek(pc);
+    interrupt_dispatched_ = false;
+
+    const uint32_t cycles = execute_step();
+    profiler_->add_cycles(make_location(bank, pc), cycles);
+
+    // Conditional calls and returns move SP only when taken
+    const bool call = opcode == 0xCD || (opcode & 0xE7) == 0xC4 || (opcode & 0xC7) == 0xC7;  // CALL, CALL cc, RST
+    const bool ret = opcode == 0xC9 || opcode == 0xD9 || (opcode & 0xE7) == 0xC0;            // RET, RETI, RET cc
+    if (interrupt_dispatched_ || (call && regs().SP == static_cast<uint16_t>(sp - 2))) {
+        profiler_->enter(make_location(bus_->get_rom_bank(regs().PC), regs().PC), regs().SP);
+    } else if (ret && regs().SP == static_cast<uint16_t>(sp + 2)) {
+        profiler_->leave(regs().SP);
+    }
+    return cycles;
+}
+
+uint32_t CPU::execute_step() {
+    const uint64_t last_tick = bus_->get_tick();
+
+    if (state_->halted) {
         if (interrupt_handler_.has_pending()) {
-            halted_ = false;
-            if (!interrupt_handler_.ime) {
-                halt_bug_ = true;
-                bus_.cycles(1);
-                return bus_.get_tick() - last_tick;
+            state_->halted = false;
+            if (!interrupt_handler_.ime()) {
+                state_->halt_bug = true;
+                bus_->cycles(1);
+                return bus_->get_tick() - last_tick;
             }
         } else {
-            bus_.cycles(1);
-            return bus_.get_tick() - last_tick;
+            bus_->cycles(1);
+            bus_->get_counters().halt_cycles++;
+            return bus_->get_tick() - last_tick;
         }
     }
 
     if (!handle_interrupts()) {
-        uint8_t opcode = bus_.read(regs.PC);
-        if (halt_bug_) {
-            halt_bug_ = false;
+        uint8_t opcode = bus_->fetch(regs().PC);
+        flight_recorder_->begin_instruction(last_tick, bus_->get_rom_bank(regs().PC), regs(), opcode);
+        if (state_->halt_bug) {
+            state_->halt_bug = false;
         } else {
-            regs.PC++;
+            regs().PC++;
         }
         const auto* current_instruction = &instruction_table[opcode];
         if (opcode == 0xCB) {  // Prefix instructions
@@ -64,20 +107,31 @@ uint32_t CPU::step() {
             current_instruction = &prefix_instruction_table[opcode];
         }
 
-        current_instruction->execute(*this, bus_);
+        current_instruction->execute(*this, *bus_);
+        bus_->get_counters().instructions++;
 
-        if (request_ime_en_) {
-            interrupt_handler_.ime = true;
-            request_ime_en_ = false;
+        if (state_->request_ime_en) {
+            interrupt_handler_.set_ime(true);
+            state_->request_ime_en = false;
         }
     }
 
-    return bus_.get_tick() - last_tick;
+    return bus_->get_tick() - last_tick;
+}
+
+void CPU::halt() {
+    state_->halted = true;
+
+    // Nothing can wake the CPU up anymore
+    if ((bus_->peek(0xFFFF) & 0x1F) == 0) {
+        LOG_ERROR_LIMITED("CPU locked up in HALT with all interrupts disabled.\n{}", flight_recorder_->dump());
+    }
 }
 
 uint8_t CPU::fetch8() {
-    const uint8_t value = bus_.read(regs.PC);
-    regs.PC++;
+    const uint8_t value = bus_->fetch(regs().PC);
+    flight_recorder_->add_byte(value);
+    regs().PC++;
     return value;
 }
 
@@ -87,35 +141,38 @@ uint16_t CPU::fetch16() {
     return (high << 8) | low;
 }
 
-uint8_t CPU::pop8() { return bus_.read(regs.SP++); }
+uint8_t CPU::pop8() { return bus_->read(regs().SP++); }
 
 uint16_t CPU::pop16() {
-    const uint8_t low = bus_.read(regs.SP++);
-    const uint8_t high = bus_.read(regs.SP++);
+    const uint8_t low = bus_->read(regs().SP++);
+    const uint8_t high = bus_->read(regs().SP++);
 
     return (high << 8) | low;
 }
 
-void CPU::push8(const uint8_t data) { bus_.write(--regs.SP, data); }
+void CPU::push8(const uint8_t data) { bus_->write(--regs().SP, data); }
 
 void CPU::push16(const uint16_t data) {
     const uint8_t high = (data >> 8) & 0xFF;
     const uint8_t low = data & 0xFF;
 
-    bus_.write(--regs.SP, high);
-    bus_.write(--regs.SP, low);
+    bus_->write(--regs().SP, high);
+    bus_->write(--regs().SP, low);
 }
 
 bool CPU::handle_interrupts() {
-    if (interrupt_handler_.ime && interrupt_handler_.has_pending()) {
+    if (interrupt_handler_.ime() && interrupt_handler_.has_pending()) {
         const uint8_t id = interrupt_handler_.get_next_pending();
-        bus_.cycles(2);
+        bus_->cycles(2);
         if (id != 0xFF) {
-            interrupt_handler_.ime = false;
-            push16(regs.PC);
+            flight_recorder_->record_interrupt(bus_->get_tick(), bus_->get_rom_bank(regs().PC), regs(), id);
+            interrupt_handler_.set_ime(false);
+            push16(regs().PC);
             interrupt_handler_.clear_flag(id);
-            regs.PC = INTERRUPT_VECTOR[id];
-            bus_.cycles(1);
+            regs().PC = INTERRUPT_VECTOR[id];
+            interrupt_dispatched_ = true;
+            bus_->get_counters().interrupts[id]++;
+            bus_->cycles(1);
         }
         return true;
     }
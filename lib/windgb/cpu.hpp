@@ -3,18 +3,23 @@
 #include <array>
 #include <cstdint>
 
+#include "flight_recorder.hpp"
 #include "interrupt.hpp"
+#include "machine_state.hpp"
+#include "profiler.hpp"
 #include "registers.hpp"
 
 namespace WindGB {
 
 class Instruction;
 class Bus;
-class IO;
 
 class CPU {
    public:
-    explicit CPU(Bus& bus, IO& io);
+    CPU(Bus& bus, MachineState& state, FlightRecorder& flight_recorder);
+
+    // Points the CPU to the components and state of another machine, after a copy
+    void link(Bus& bus, MachineState& state, FlightRecorder& flight_recorder);
 
     void init();
     uint32_t step();
@@ -26,21 +31,32 @@ class CPU {
     void push8(uint8_t data);
     void push16(uint16_t data);
 
-    void request_ime_en() { request_ime_en_ = true; }
+    void request_ime_en() { state_->request_ime_en = true; }
 
     InterruptHandler& get_interrupt_handler() { return interrupt_handler_; }
-    void halt() { halted_ = true; }
+    void halt();
+
+    [[nodiscard]] const FlightRecorder& get_flight_recorder() const { return *flight_recorder_; }
+    // Attributes the cycles of every step to the profiler, nullptr to stop
+    void set_profiler(Profiler* profiler) { profiler_ = profiler; }
+    [[nodiscard]] Profiler* get_profiler() const { return profiler_; }
+
+    [[nodiscard]] uint64_t hash_state() const;
 
-    Registers regs;
+    [[nodiscard]] Registers& regs() { return state_->regs; }
+    [[nodiscard]] const Registers& regs() const { return state_->regs; }
 
    private:
-    Bus& bus_;
+    Bus* bus_;
+    MachineState* state_;
     InterruptHandler interrupt_handler_;
+    FlightRecorder* flight_recorder_;  // Owned by the machine, a snapshot does not take the history
+    Profiler* profiler_ = nullptr;
 
-    bool request_ime_en_ = false;
-    bool halted_ = false;
-    bool halt_bug_ = false;
+    bool interrupt_dispatched_ = false;  // Only tracked for the profiler
 
+    uint32_t execute_step();
+    uint32_t profile_step();
     bool handle_interrupts();
 };
 
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+namespace WindGB {
+
+// Write tracking at a fixed granularity. Every observer gets its own bitmap so that consuming the changes does not hide them from the others.
+template <size_t N, size_t MaxObservers = 4>
+class DirtyTracker {
+   public:
+    using Bitmap = std::bitset<N>;
+
+    // New observers start with everything marked dirty
+    uint8_t add_observer() {
+        if (observer_count_ == MaxObservers) {
+            throw std::length_error("Too many dirty tracking observers");
+        }
+        bitmaps_[observer_count_].set();
+        return observer_count_++;
+    }
+
+    void mark(const size_t index) {
+        for (uint8_t i = 0; i < observer_count_; i++) {
+            bitmaps_[i].set(index);
+        }
+    }
+    void mark_all() {
+        for (uint8_t i = 0; i < observer_count_; i++) {
+            bitmaps_[i].set();
+        }
+    }
+
+    [[nodiscard]] const Bitmap& get(const uint8_t observer) const { return bitmaps_[observer]; }
+    void clear(const uint8_t observer) { bitmaps_[observer].reset(); }
+
+   private:
+    std::array<Bitmap, MaxObservers> bitmaps_;
+    uint8_t observer_count_ = 0;
+};
+
+// Granularity of the incremental snapshots
+constexpr size_t PAGE_SIZE = 256;
+
+// Epoch of the last write to each page. The machine moves the epoch forward at every snapshot, the pages stamped with
+// the epoch following a snapshot or a later one differ from it.
+template <size_t Pages>
+class PageTracker {
+   public:
+    using Bitmap = std::bitset<Pages>;
+
+    void mark(const size_t page) {
+        epochs_[page] = epoch_;
+        group_epochs_[page / GROUP_SIZE] = epoch_;
+    }
+    void mark_all() {
+        epochs_.fill(epoch_);
+        group_epochs_.fill(epoch_);
+    }
+    void set_epoch(const uint32_t epoch) { epoch_ = epoch; }
+
+    [[nodiscard]] Bitmap written_since(const uint32_t epoch) const {
+        // Only the groups written since are scanned, one word at a time
+        Bitmap pages;
+        for (size_t group = 0; group < GROUPS; group++) {
+            if (group_epochs_[group] < epoch) continue;
+            const size_t base = group * GROUP_SIZE;
+            uint64_t word = 0;
+            for (size_t page = base; page < std::min(base + GROUP_SIZE, Pages); page++) {
+                word |= static_cast<uint64_t>(epochs_[page] >= epoch) << (page - base);
+            }
+            pages |= Bitmap(word) << base;
+        }
+        return pages;
+    }
+
+   private:
+    static constexpr size_t GROUP_SIZE = 64;
+    static constexpr size_t GROUPS = (Pages + GROUP_SIZE - 1) / GROUP_SIZE;
+
+    std::array<uint32_t, Pages> epochs_{};
+    std::array<uint32_t, GROUPS> group_epochs_{};  // Latest epoch of the pages of each group
+    uint32_t epoch_ = 0;
+};
+
+// Copies the pages of source set in pages into target and stamps them in the tracker of target if any, returns the bytes copied
+template <size_t Pages>
+size_t copy_pages(const uint8_t* source, uint8_t* target, const size_t size, const std::bitset<Pages>& pages, PageTracker<Pages>* tracker = nullptr) {
+    if (pages.none()) return 0;
+    size_t copied = 0;
+    for (size_t page = 0; page < Pages && page * PAGE_SIZE < size; page++) {
+        if (!pages[page]) continue;
+        const size_t length = std::min(PAGE_SIZE, size - page * PAGE_SIZE);
+        std::memcpy(target + page * PAGE_SIZE, source + page * PAGE_SIZE, length);
+        if (tracker) tracker->mark(page);
+        copied += length;
+    }
+    return copied;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,206 @@
+#include "flight_recorder.hpp"
+
+#include <algorithm>
+#include <csignal>
+#include <cstring>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "bus.hpp"
+#include "instructions.hpp"
+
+namespace WindGB {
+
+thread_local const FlightRecorder* FlightRecorder::crash_dump_ = nullptr;
+
+std::vector<TraceEntry> FlightRecorder::get_entries() const {
+    const uint64_t count = std::min<uint64_t>(next_, CAPACITY);
+
+    std::vector<TraceEntry> entries;
+    entries.reserve(count);
+    for (uint64_t i = next_ - count; i < next_; i++) {
+        entries.push_back(entries_[i & (CAPACITY - 1)]);
+    }
+    return entries;
+}
+
+namespace {
+
+// Formats into a fixed buffer without allocating nor going through stdio, so that the abort handler can use it
+class LineWriter {
+   public:
+    LineWriter(char* data, const size_t size) : data_(data), size_(size) {}
+
+    [[nodiscard]] size_t length() const { return length_; }
+
+    void put(const char c) {
+        if (length_ < size_) data_[length_++] = c;
+    }
+    void put(const char* text, const size_t count) {
+        for (size_t i = 0; i < count; i++) put(text[i]);
+    }
+    void put(const char* text) { put(text, std::strlen(text)); }
+    void hex(const uint32_t value, const int digits) {
+        for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4) put("0123456789ABCDEF"[(value >> shift) & 0x0F]);
+    }
+    void dec(uint64_t value, const size_t width = 0) {
+        char digits[20];
+        size_t count = 0;
+        do {
+            digits[count++] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        } while (value > 0);
+        for (size_t i = count; i < width; i++) put(' ');
+        while (count > 0) put(digits[--count]);
+    }
+    // Left aligned in a column ending at the given length
+    void pad_to(const size_t column) {
+        while (length_ < column) put(' ');
+    }
+
+   private:
+    char* data_;
+    size_t size_;
+    size_t length_ = 0;
+};
+
+// Writes the mnemonic of the instruction table with its operands in place of n8/n16/e8
+void write_mnemonic(LineWriter& out, const TraceEntry& entry) {
+    const bool prefixed = entry.bytes[0] == 0xCB && entry.length >= 2;
+    const std::string& name = prefixed ? prefix_instruction_table[entry.bytes[1]].name : instruction_table[entry.bytes[0]].name;
+
+    const size_t pos_n16 = name.find("n16");
+    const size_t pos_n8 = name.find("n8");
+    const size_t pos_e8 = name.find("e8");
+    if (pos_n16 != std::string::npos && entry.length == 3) {
+        out.put(name.c_str(), pos_n16);
+        out.put('$');
+        out.hex(entry.bytes[1] | (entry.bytes[2] << 8), 4);
+        out.put(name.c_str() + pos_n16 + 3);
+    } else if (pos_n8 != std::string::npos && entry.length == 2) {
+        out.put(name.c_str(), pos_n8);
+        out.put('$');
+        out.hex(entry.bytes[1], 2);
+        out.put(name.c_str() + pos_n8 + 2);
+    } else if (pos_e8 != std::string::npos && entry.length == 2) {
+        const auto offset = static_cast<int8_t>(entry.bytes[1]);
+        out.put(name.c_str(), pos_e8);
+        out.put(offset < 0 ? '-' : '+');
+        out.dec(offset < 0 ? -offset : offset);
+        out.put(name.c_str() + pos_e8 + 2);
+    } else {
+        out.put(name.c_str());
+    }
+}
+
+// Writes one line of the dump, returns its length
+size_t format_line(const TraceEntry& entry, char* line, const size_t size) {
+    LineWriter out(line, size);
+    out.dec(entry.cycle, 12);
+    out.put("  ");
+    if (entry.bank == Bus::NO_BANK) {
+        out.put("--");
+    } else {
+        out.hex(entry.bank, entry.bank > 0xFF ? 3 : 2);
+    }
+    out.put(':');
+    out.hex(entry.pc, 4);
+    out.put("  ");
+
+    // Bytes and mnemonic in columns of 9 and 20 characters
+    if (entry.length == 0) {
+        out.pad_to(out.length() + 9);
+        out.put(' ');
+        const size_t column = out.length();
+        out.put("<interrupt ");
+        out.dec(entry.bytes[0]);
+        out.put('>');
+        out.pad_to(column + 20);
+    } else {
+        const size_t bytes_column = out.length();
+        for (uint8_t i = 0; i < entry.length; i++) {
+            out.hex(entry.bytes[i], 2);
+            out.put(' ');
+        }
+        out.pad_to(bytes_column + 9);
+        out.put(' ');
+        const size_t column = out.length();
+        write_mnemonic(out, entry);
+        out.pad_to(column + 20);
+    }
+
+    out.put(" AF=");
+    out.hex(entry.af, 4);
+    out.put(" BC=");
+    out.hex(entry.bc, 4);
+    out.put(" DE=");
+    out.hex(entry.de, 4);
+    out.put(" HL=");
+    out.hex(entry.hl, 4);
+    out.put(" SP=");
+    out.hex(entry.sp, 4);
+    return out.length();
+}
+
+constexpr char DUMP_HEADER[] = "Last executed instructions (cycle, bank:PC, bytes, instruction, registers before it):\n";
+constexpr size_t LINE_SIZE = 160;
+
+void write_stderr(const char* data, const size_t size) {
+#ifdef _WIN32
+    (void)_write(2, data, static_cast<unsigned int>(size));
+#else
+    (void)write(STDERR_FILENO, data, size);
+#endif
+}
+
+}  // namespace
+
+std::string FlightRecorder::format(const TraceEntry& entry) {
+    char line[LINE_SIZE];
+    return {line, format_line(entry, line, sizeof(line))};
+}
+
+std::string FlightRecorder::dump() const {
+    std::string out = DUMP_HEADER;
+    for (const TraceEntry& entry : get_entries()) {
+        out += format(entry);
+        out += '\n';
+    }
+    return out;
+}
+
+void FlightRecorder::write_dump() const {
+    static char line[LINE_SIZE + 1];
+    write_stderr(DUMP_HEADER, sizeof(DUMP_HEADER) - 1);
+    const uint64_t count = std::min<uint64_t>(next_, CAPACITY);
+    for (uint64_t i = next_ - count; i < next_; i++) {
+        size_t length = format_line(entries_[i & (CAPACITY - 1)], line, LINE_SIZE);
+        line[length++] = '\n';
+        write_stderr(line, length);
+    }
+}
+
+void FlightRecorder::install_crash_handler() {
+    static bool installed = false;
+    if (!installed) {
+        std::signal(SIGABRT, on_abort);
+        installed = true;
+    }
+}
+
+void FlightRecorder::on_abort(const int signal) {
+    // Best effort, the process is going down anyway. Only async-signal-safe calls from here on: the lines are formatted
+    // into a static buffer and written straight to the file descriptor.
+    if (const FlightRecorder* recorder = crash_dump_) {
+        crash_dump_ = nullptr;
+        recorder->write_dump();
+    }
+
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+}
+
+}  // namespace WindGB
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "registers.hpp"
+
+namespace WindGB {
+
+// One executed instruction, or an interrupt dispatch when length is 0
+struct TraceEntry {
+    uint64_t cycle;  // Bus tick at the start of the instruction
+    uint16_t bank;   // ROM bank of PC, Bus::NO_BANK outside of the cartridge ROM
+    uint16_t pc;
+    uint16_t af, bc, de, hl, sp;   // Before the instruction
+    std::array<uint8_t, 3> bytes;  // Opcode and operands, interrupt id for a dispatch
+    uint8_t length;
+};
+
+// Always-on ring buffer of the last executed instructions, dumped when the CPU crashes
+class FlightRecorder {
+   public:
+    static constexpr size_t CAPACITY = 1024;  // Power of two
+
+    void begin_instruction(const uint64_t cycle, const uint16_t bank, const Registers& regs, const uint8_t opcode) {
+        TraceEntry& entry = begin(cycle, bank, regs);
+        entry.bytes[0] = opcode;
+        entry.length = 1;
+    }
+    // Operand bytes of the current instruction, captured by CPU::fetch8
+    void add_byte(const uint8_t byte) {
+        TraceEntry& entry = entries_[(next_ - 1) & (CAPACITY - 1)];
+        if (entry.length < 3) entry.bytes[entry.length++] = byte;
+    }
+    void record_interrupt(const uint64_t cycle, const uint16_t bank, const Registers& regs, const uint8_t id) {
+        TraceEntry& entry = begin(cycle, bank, regs);
+        entry.bytes[0] = id;
+        entry.length = 0;
+    }
+
+    // Forgets the recorded instructions
+    void clear() { next_ = 0; }
+
+    // Oldest first
+    [[nodiscard]] std::vector<TraceEntry> get_entries() const;
+    [[nodiscard]] std::string dump() const;
+    // Same written straight to stderr, whatever the logger setup. Does not allocate, safe from a signal handler.
+    void write_dump() const;
+    [[nodiscard]] static std::string format(const TraceEntry& entry);
+
+    // Dumps the recorder of the active Scope of the aborting thread to stderr when the process aborts (failed
+    // assertion, std::terminate)
+    static void install_crash_handler();
+
+    // Makes the recorder the one dumped if the current thread aborts while it is alive
+    class Scope {
+       public:
+        explicit Scope(const FlightRecorder* recorder) : previous_(crash_dump_) { crash_dump_ = recorder; }
+        ~Scope() { crash_dump_ = previous_; }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+       private:
+        const FlightRecorder* previous_;
+    };
+
+   private:
+    std::array<TraceEntry, CAPACITY> entries_{};
+    uint64_t next_ = 0;
+
+    static thread_local const FlightRecorder* crash_dump_;
+
+    TraceEntry& begin(const uint64_t cycle, const uint16_t bank, const Registers& regs) {
+        TraceEntry& entry = entries_[next_++ & (CAPACITY - 1)];
+        entry.cycle = cycle;
+        entry.bank = bank;
+        entry.pc = regs.PC;
+        entry.af = regs.AF;
+        entry.bc = regs.BC;
+        entry.de = regs.DE;
+        entry.hl = regs.HL;
+        entry.sp = regs.SP;
+        return entry;
+    }
+
+    static void on_abort(int signal);
+};
+
+}  // namespace WindGB
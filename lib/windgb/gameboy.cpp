@@ -1,17 +1,222 @@
 #include "gameboy.hpp"
 
+#include <atomic>
+#include <stdexcept>
+#include <utility>
+
 #include "common.hpp"
 #include "logger.hpp"
 #include "ppu.hpp"
 #include "timer.hpp"
+#include "trace.hpp"
 
 namespace WindGB {
 
-GameBoy::GameBoy() : cpu_(bus_, io_), timer_(bus_, io_), ppu_(bus_, io_) {}
+static std::atomic<uint64_t> next_snapshot_id = 1;
+
+GameBoy::GameBoy()
+    : bus_(state_),
+      cpu_(bus_, state_, flight_recorder_),
+      wram_(state_),
+      hram_(state_),
+      vram_(state_),
+      oam_(state_),
+      io_(state_),
+      timer_(state_),
+      ppu_(bus_, state_, vram_, oam_, screen_),
+      snapshot_id_(next_snapshot_id++) {}
+
+template <typename F>
+void GameBoy::for_each_page_tracker(F&& f) {
+    f(wram_.get_pages());
+    f(vram_.get_pages());
+    f(oam_.get_pages());
+    f(screen_.lines);
+    if (MBC* mbc = cartridge_ ? cartridge_->get_mbc() : nullptr) f(mbc->get_ram_pages());
+}
+
+GameBoy::GameBoy(const GameBoy& other) : GameBoy() { other.clone_into(*this); }
+
+GameBoy& GameBoy::operator=(const GameBoy& other) {
+    other.clone_into(*this);
+    return *this;
+}
+
+void GameBoy::clone_into(GameBoy& target) const {
+    if (&target == this) return;
+
+    target.cartridge_ = target.cartridge_copy_.get();
+    target.copy_state(*this);
+    target.flight_recorder_.clear();
+}
+
+size_t GameBoy::save_snapshot(Snapshot& snapshot) {
+    TRACE_SCOPE("Save snapshot");
+    if (!snapshot.data_) snapshot.data_ = std::make_unique<Snapshot::Data>();
+    Snapshot::Data& data = *snapshot.data_;
+
+    size_t copied;
+    if (snapshot.machine_ == snapshot_id_) {
+        const PageSet pages = written_since(snapshot.epoch_);
+        static_cast<CoreState&>(data.state) = state_;
+        copied = copy_pages(state_.wram.data(), data.state.wram.data(), state_.wram.size(), pages.wram);
+        copied += copy_pages(state_.vram.data(), data.state.vram.data(), state_.vram.size(), pages.vram);
+        copied += copy_pages(state_.oam.data(), data.state.oam.data(), state_.oam.size(), pages.oam);
+        copied += data.screen.copy_lines(screen_, pages.screen);
+        copied += copy_cartridge(cartridge_, data.cartridge, &pages.cartridge_ram);
+    } else {
+        data.state = state_;
+        data.screen.framebuffers = screen_.framebuffers;
+        data.screen.shades = screen_.shades;
+        copied = sizeof(MachineState) + sizeof(Screen::framebuffers) + sizeof(Screen::shades);
+        copied += copy_cartridge(cartridge_, data.cartridge, nullptr);
+    }
+    data.ppu = ppu_;
+    data.counters = bus_.get_counters();
+    data.published_counters = bus_.get_published_counters();
+    data.state_log_frame = state_log_frame_;
 
-void GameBoy::insert(Cartridge* cartridge) { cartridge_ = cartridge; }
+    start_epoch();
+    snapshot.machine_ = snapshot_id_;
+    snapshot.epoch_ = epoch_;
+    return copied;
+}
+
+size_t GameBoy::restore_snapshot(const Snapshot& snapshot) {
+    TRACE_SCOPE("Restore snapshot");
+    if (snapshot.empty()) {
+        throw std::runtime_error("Unable to restore an empty snapshot");
+    }
+    const Snapshot::Data& data = *snapshot.data_;
+
+    // The copied VRAM and OAM pages are marked dirty, the PPU only redraws the parts of its caches they cover
+    Cartridge* previous_cartridge = cartridge_;
+    const bool same_machine = snapshot.machine_ == snapshot_id_;
+    size_t copied;
+    if (same_machine) {
+        const PageSet pages = written_since(snapshot.epoch_);
+        static_cast<CoreState&>(state_) = data.state;
+        copied = wram_.copy_pages(data.state, pages.wram);
+        copied += vram_.copy_pages(data.state, pages.vram);
+        copied += oam_.copy_pages(data.state, pages.oam);
+        copied += screen_.copy_lines(data.screen, pages.screen);
+        copied += copy_cartridge(data.cartridge.get(), &pages.cartridge_ram);
+    } else {
+        // The pages differing from a snapshot of another instance are unknown
+        state_ = data.state;
+        screen_.framebuffers = data.screen.framebuffers;
+        screen_.shades = data.screen.shades;
+        copied = sizeof(MachineState) + sizeof(Screen::framebuffers) + sizeof(Screen::shades);
+        copied += copy_cartridge(data.cartridge.get(), nullptr);
+        mark_all_copied();
+    }
+
+    VideoRecorder* recorder = ppu_.get_recorder();
+    ppu_ = *data.ppu;
+    ppu_.link(bus_, state_, vram_, oam_, screen_);
+    ppu_.set_recorder(recorder);
+    if (!same_machine) ppu_.invalidate_lines();  // The fingerprints refer to the caches of the other instance
+    bus_.restore_counters(data.counters, data.published_counters);
+    state_log_frame_ = data.state_log_frame;
+
+    if (cartridge_ != previous_cartridge) {
+        bus_.replace_component(previous_cartridge, cartridge_);
+        bus_.link_cartridge(cartridge_);
+    }
+    return copied;
+}
+
+void GameBoy::copy_state(const GameBoy& source) {
+    Profiler* profiler = cpu_.get_profiler();
+    VideoRecorder* recorder = ppu_.get_recorder();
+
+    state_ = source.state_;
+    bus_ = source.bus_;
+    cpu_ = source.cpu_;
+    io_ = source.io_;
+    timer_ = source.timer_;
+    ppu_ = source.ppu_;
+    state_log_frame_ = source.state_log_frame_;
+    copy_cartridge(source.cartridge_, nullptr);
+
+    // The copies still point to the components and state of source
+    bus_.link_state(state_);
+    cpu_.link(bus_, state_, flight_recorder_);
+    io_.link(state_);
+    timer_.link(state_);
+    ppu_.link(bus_, state_, vram_, oam_, screen_);
+    const std::pair<const Component*, Component*> components[] = {
+        {source.cartridge_, cartridge_}, {&source.wram_, &wram_}, {&source.hram_, &hram_},
+        {&source.vram_, &vram_},         {&source.oam_, &oam_},   {&source.io_, &io_},
+    };
+    for (const auto& [component, replacement] : components) {
+        bus_.replace_component(component, replacement);
+    }
+    bus_.link_ppu(&ppu_);
+    bus_.link_timer(&timer_);
+    bus_.link_cartridge(cartridge_);
+    cpu_.set_profiler(profiler);
+    ppu_.set_recorder(recorder);
+
+    // The screen is left behind, and the line fingerprints refer to the caches of source
+    mark_all_copied();
+    ppu_.invalidate_lines();
+}
+
+size_t GameBoy::copy_cartridge(const Cartridge* source, const MBC::RamPages::Bitmap* pages) {
+    // Restored in place into an inserted cartridge, copied into an owned one otherwise
+    if (!source) {
+        cartridge_ = nullptr;
+        return 0;
+    }
+    if (!cartridge_ || cartridge_ == source) {
+        if (!cartridge_copy_) cartridge_copy_ = std::make_unique<Cartridge>();
+        cartridge_ = cartridge_copy_.get();
+    }
+    return cartridge_->copy_from(*source, pages);
+}
+
+size_t GameBoy::copy_cartridge(const Cartridge* source, std::unique_ptr<Cartridge>& target, const MBC::RamPages::Bitmap* pages) {
+    if (!source) {
+        target.reset();
+        return 0;
+    }
+    if (!target) target = std::make_unique<Cartridge>();
+    return target->copy_from(*source, pages);
+}
+
+void GameBoy::mark_all_copied() {
+    vram_.mark_dirty(VRAM::Pages::Bitmap().set());
+    oam_.mark_dirty(OAM::Pages::Bitmap().set());
+    for_each_page_tracker([this](auto& tracker) {
+        tracker.set_epoch(epoch_);  // A copied cartridge brings its own tracker
+        tracker.mark_all();
+    });
+}
+
+GameBoy::PageSet GameBoy::written_since(const uint32_t epoch) {
+    PageSet pages;
+    pages.wram = wram_.get_pages().written_since(epoch);
+    pages.vram = vram_.get_pages().written_since(epoch);
+    pages.oam = oam_.get_pages().written_since(epoch);
+    pages.screen = screen_.lines.written_since(epoch);
+    if (MBC* mbc = cartridge_ ? cartridge_->get_mbc() : nullptr) pages.cartridge_ram = mbc->get_ram_pages().written_since(epoch);
+    return pages;
+}
+
+void GameBoy::start_epoch() {
+    epoch_++;
+    for_each_page_tracker([this](auto& tracker) { tracker.set_epoch(epoch_); });
+}
+
+void GameBoy::insert(Cartridge* cartridge) {
+    cartridge_ = cartridge;
+    snapshot_id_ = next_snapshot_id++;  // The snapshots taken so far do not know the pages of this cartridge
+}
+
+void GameBoy::init(const BootMode boot_mode) {
+    const Logger::Scope log_scope(logger_.get());
 
-void GameBoy::init() {
     bus_.link(cartridge_, 0x0000, 0x7FFF, "Cartridge ROM");
     bus_.link(cartridge_, 0xA000, 0xBFFF, "Cartridge RAM");
     bus_.link(&wram_, WRAM_ADDR_START, WRAM_ADDR_END, "WRAM");
@@ -23,15 +228,55 @@ void GameBoy::init() {
 
     bus_.link_ppu(&ppu_);
     bus_.link_timer(&timer_);
+    bus_.link_cartridge(cartridge_);
 
     cpu_.init();
+    FlightRecorder::install_crash_handler();
     ppu_.init();
     timer_.init();
+    if (boot_mode == BootMode::SKIP) {
+        skip_boot();
+    }
 
     LOG_INFO(bus_.memap_to_string());
     LOG_INFO("Gameboy initialized");
 }
 
-uint32_t GameBoy::step() { return cpu_.step(); }
+uint32_t GameBoy::step() {
+    const uint32_t cycles = cpu_.step();
+
+    if (state_log_ && ppu_.get_frame_count() != state_log_frame_) {
+        state_log_frame_ = ppu_.get_frame_count();
+        state_log_->record(hash_state());
+    }
+    return cycles;
+}
+
+// Saves the ~1.8M M-cycles of the boot animation
+void GameBoy::skip_boot() {
+    write_post_boot_state(bus_);
+    timer_.init(POST_BOOT_DIV_COUNTER);
+    cpu_.regs().F = bus_.direct_read(CARTRIDGE_HEADER_CHECKSUM) ? 0xB0 : 0x80;  // H and C are only set for a non-zero header checksum
+    cpu_.regs().PC = CARTRIDGE_HEADER_ENTRY_POINT;
+}
+
+StateHashes GameBoy::hash_state() {
+    timer_.sync();
+    ppu_.sync();
+
+    StateHashes hashes;
+    hashes.frame = ppu_.get_frame_count();
+    hashes[StateField::CPU] = cpu_.hash_state();
+    hashes[StateField::BUS] = bus_.hash_state();
+    hashes[StateField::IO] = io_.hash_state();
+    hashes[StateField::WRAM] = wram_.hash_state();
+    hashes[StateField::HRAM] = hram_.hash_state();
+    hashes[StateField::VRAM] = vram_.hash_state();
+    hashes[StateField::OAM] = oam_.hash_state();
+    hashes[StateField::MBC] = cartridge_ ? cartridge_->hash_state() : 0;
+    hashes[StateField::PPU] = ppu_.hash_state();
+    hashes[StateField::TIMER] = timer_.hash_state();
+    return hashes;
+}
 
 }  // namespace WindGB
\ No newline at end of file
@@ -1,11 +1,18 @@
 #pragma once
 
+#include <memory>
+
+#include "boot_rom.hpp"
 #include "bus.hpp"
 #include "cartridge.hpp"
 #include "cpu.hpp"
 #include "io.hpp"
+#include "logger.hpp"
+#include "machine_state.hpp"
 #include "ppu.hpp"
 #include "ram.hpp"
+#include "snapshot.hpp"
+#include "state_hash.hpp"
 #include "timer.hpp"
 
 namespace WindGB {
@@ -13,16 +20,88 @@ namespace WindGB {
 class GameBoy {
    public:
     GameBoy();
+    // Same as clone_into
+    GameBoy(const GameBoy& other);
+    GameBoy& operator=(const GameBoy& other);
+
+    // Duplicates the running machine into target, which can then run on its own. The cartridge is copied into one owned
+    // by target sharing the ROM. Target keeps its logger, profiler, video recorder and state log. The screen and the
+    // instruction history are derived output and not copied: target starts an empty history and redraws every line,
+    // showing its own screen until then.
+    void clone_into(GameBoy& target) const;
+
+    // Saves the machine into snapshot, see Snapshot. Returns the bytes of pages and screen lines copied.
+    size_t save_snapshot(Snapshot& snapshot);
+    // Brings the machine back to snapshot, the cartridge state is restored into the inserted cartridge. Returns the
+    // bytes of pages and screen lines copied.
+    size_t restore_snapshot(const Snapshot& snapshot);
 
     void insert(Cartridge* cartridge);
-    void init();
+    // Replaces the embedded boot ROM, before init
+    void set_boot_rom(const BootRom& boot_rom) { bus_.set_boot_rom(boot_rom); }
+    void init(BootMode boot_mode = BootMode::BOOT_ROM);
+    // Runs one instruction, within a Session
     uint32_t step();
 
+    // Routes the log messages of the current thread to the logger of the machine and makes its instruction history the
+    // one dumped on abort while it is alive. Installed once around a run loop, set the logger before.
+    class Session {
+       public:
+        explicit Session(const GameBoy& gameboy) : log_scope_(gameboy.logger_.get()), crash_scope_(&gameboy.flight_recorder_) {}
+
+       private:
+        Logger::Scope log_scope_;
+        FlightRecorder::Scope crash_scope_;
+    };
+
+    CPU& get_cpu() { return cpu_; }
+    Bus& get_bus() { return bus_; }
     PPU& get_ppu() { return ppu_; }
     IO& get_io() { return io_; }
+    VRAM& get_vram() { return vram_; }
+    OAM& get_oam() { return oam_; }
+    Joypad& get_joypad() { return *io_.get_joypad(); }
+    Cartridge* get_cartridge() const { return cartridge_; }
+
+    // Emulated time in M-cycles since init
+    [[nodiscard]] uint64_t get_tick() const { return bus_.get_tick(); }
+    // Up to date event counters, from the emulation thread only
+    [[nodiscard]] PerfCounters get_counters() const { return bus_.snapshot_counters(); }
+    // Event counters as of the last presented frame, consistent from any thread
+    [[nodiscard]] PerfCounters get_published_counters() const { return bus_.get_published_counters(); }
+
+    // Hashes every part of the machine state, the lazily updated components are synced first
+    StateHashes hash_state();
+    // Records the state hashes of every presented frame into the log, nullptr to stop
+    void set_state_log(StateHashLog* log) { state_log_ = log; }
+    // Profiles the guest code from now on, nullptr to stop. Costs a pointer check per instruction when disabled.
+    void set_profiler(Profiler* profiler) { cpu_.set_profiler(profiler); }
+#ifdef WINDGB_MEMORY_STATS
+    [[nodiscard]] const MemoryStats& get_memory_stats() const { return bus_.get_memory_stats(); }
+#endif
+    // Logger used by this instance instead of the default one, see Logger::create
+    void set_logger(std::shared_ptr<spdlog::logger> logger) { logger_ = std::move(logger); }
+
+    // Identity of the last presented frame, equal hashes mean identical frames
+    [[nodiscard]] uint64_t get_frame_hash() const { return ppu_.get_frame_hash(); }
+
+    // Last executed instructions, oldest first
+    [[nodiscard]] std::string dump_trace() const { return cpu_.get_flight_recorder().dump(); }
 
    private:
+    // Pages of the paged memories and lines of the screen to copy
+    struct PageSet {
+        WRAM::Pages::Bitmap wram;
+        VRAM::Pages::Bitmap vram;
+        OAM::Pages::Bitmap oam;
+        MBC::RamPages::Bitmap cartridge_ram;
+        Screen::Lines::Bitmap screen;
+    };
+
+    MachineState state_;
     Bus bus_;
+    FlightRecorder flight_recorder_;
+    Screen screen_;
     CPU cpu_;
     WRAM wram_;
     HRAM hram_;
@@ -34,6 +113,30 @@ class GameBoy {
 
     // Components
     Cartridge* cartridge_ = nullptr;  // External component
+    std::unique_ptr<Cartridge> cartridge_copy_;  // Cartridge of a clone, or restored from a snapshot without an inserted one
+
+    std::shared_ptr<spdlog::logger> logger_;
+    StateHashLog* state_log_ = nullptr;
+    uint64_t state_log_frame_ = 0;
+
+    // Snapshots of this instance, not copied
+    uint64_t snapshot_id_;
+    uint32_t epoch_ = 0;
+
+    void skip_boot();
+    // Copies the machine state of source for a clone
+    void copy_state(const GameBoy& source);
+    // Copies the cartridge state of source into the inserted cartridge, into the owned one when there is none or it is
+    // source, only the given RAM pages when pages is set. Returns the bytes copied.
+    size_t copy_cartridge(const Cartridge* source, const MBC::RamPages::Bitmap* pages);
+    // Same into the cartridge of a snapshot
+    static size_t copy_cartridge(const Cartridge* source, std::unique_ptr<Cartridge>& target, const MBC::RamPages::Bitmap* pages);
+    // Marks every page copied, for the PPU caches and the snapshots of this instance
+    void mark_all_copied();
+    PageSet written_since(uint32_t epoch);
+    void start_epoch();
+    template <typename F>
+    void for_each_page_tracker(F&& f);
 };
 
 }  // namespace WindGB
\ No newline at end of file
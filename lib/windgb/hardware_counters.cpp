@@ -0,0 +1,147 @@
+#include "hardware_counters.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#endif
+
+namespace WindGB {
+
+const char* hardware_event_name(const HardwareEvent event) {
+    switch (event) {
+        case HardwareEvent::CYCLES:
+            return "Cycles";
+        case HardwareEvent::INSTRUCTIONS:
+            return "Instructions";
+        case HardwareEvent::BRANCH_MISSES:
+            return "Branch misses";
+        case HardwareEvent::L1D_MISSES:
+            return "L1d read misses";
+        case HardwareEvent::LLC_MISSES:
+            return "LLC read misses";
+        case HardwareEvent::ITLB_MISSES:
+            return "iTLB misses";
+        default:
+            return "Unknown";
+    }
+}
+
+#ifdef __linux__
+
+static constexpr uint64_t cache_read_miss(const uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+static constexpr std::array<EventConfig, HARDWARE_EVENT_COUNT> EVENT_CONFIGS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_LL)},
+    {PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_ITLB)},
+}};
+
+HardwareCounters::HardwareCounters() {
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = EVENT_CONFIGS[i].type;
+        attr.config = EVENT_CONFIGS[i].config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;  // Allowed up to perf_event_paranoid 2
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fds_[i] < 0 && error_.empty()) {
+            error_ = std::string(hardware_event_name(static_cast<HardwareEvent>(i))) + ": " + std::strerror(errno);
+        }
+    }
+}
+
+HardwareCounters::~HardwareCounters() {
+    for (const int fd : fds_) {
+        if (fd >= 0) close(fd);
+    }
+}
+
+void HardwareCounters::start() {
+    for (const int fd : fds_) {
+        if (fd < 0) continue;
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void HardwareCounters::stop() {
+    for (const int fd : fds_) {
+        if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        values_[i] = 0;
+        uint64_t data[3];  // Value, time enabled, time running
+        if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+        values_[i] = data[2] < data[1] ? static_cast<uint64_t>(static_cast<double>(data[0]) * data[1] / data[2]) : data[0];
+    }
+}
+
+#else
+
+HardwareCounters::HardwareCounters() : error_("perf_event_open is only available on Linux") { fds_.fill(-1); }
+
+HardwareCounters::~HardwareCounters() = default;
+
+void HardwareCounters::start() {}
+
+void HardwareCounters::stop() {}
+
+#endif
+
+bool HardwareCounters::any_available() const {
+    for (const int fd : fds_) {
+        if (fd >= 0) return true;
+    }
+    return false;
+}
+
+static double ratio(const uint64_t a, const uint64_t b) { return b ? static_cast<double>(a) / static_cast<double>(b) : 0.0; }
+
+std::string format_hardware_counters(const HardwareCounters& counters, const uint64_t frames, const uint64_t guest_instructions) {
+    char line[128];
+    std::string out;
+
+    std::snprintf(line, sizeof(line), "%-22s %16s %16s %16s\n", "Host event", "Total", "Per frame", "Per guest instr");
+    out += line;
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        const auto event = static_cast<HardwareEvent>(i);
+        if (!counters.is_available(event)) {
+            std::snprintf(line, sizeof(line), "%-22s %16s\n", hardware_event_name(event), "unavailable");
+        } else {
+            const uint64_t value = counters.get(event);
+            std::snprintf(line, sizeof(line), "%-22s %16llu %16.1f %16.3f\n", hardware_event_name(event), static_cast<unsigned long long>(value),
+                          ratio(value, frames), ratio(value, guest_instructions));
+        }
+        out += line;
+    }
+
+    if (counters.is_available(HardwareEvent::CYCLES) && counters.is_available(HardwareEvent::INSTRUCTIONS)) {
+        std::snprintf(line, sizeof(line), "%-22s %16.2f\n", "Host IPC", ratio(counters.get(HardwareEvent::INSTRUCTIONS), counters.get(HardwareEvent::CYCLES)));
+        out += line;
+    }
+    return out;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace WindGB {
+
+enum class HardwareEvent : uint8_t {
+    CYCLES = 0,
+    INSTRUCTIONS,
+    BRANCH_MISSES,
+    L1D_MISSES,
+    LLC_MISSES,
+    ITLB_MISSES,
+    COUNT,
+};
+
+constexpr size_t HARDWARE_EVENT_COUNT = static_cast<size_t>(HardwareEvent::COUNT);
+
+[[nodiscard]] const char* hardware_event_name(HardwareEvent event);
+
+// Host CPU counters of the calling thread, read with perf_event_open between start and stop (Linux only, user space only).
+// Events the kernel refuses, as in most containers or with a high perf_event_paranoid, are left unavailable.
+class HardwareCounters {
+   public:
+    HardwareCounters();
+    ~HardwareCounters();
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    void start();
+    void stop();
+
+    [[nodiscard]] bool is_available(HardwareEvent event) const { return fds_[static_cast<size_t>(event)] >= 0; }
+    [[nodiscard]] bool any_available() const;
+    // Count between the last start and stop, scaled up when the kernel multiplexed the event
+    [[nodiscard]] uint64_t get(HardwareEvent event) const { return values_[static_cast<size_t>(event)]; }
+    // Why the first unavailable event could not be opened
+    [[nodiscard]] const std::string& get_error() const { return error_; }
+
+   private:
+    std::array<int, HARDWARE_EVENT_COUNT> fds_;
+    std::array<uint64_t, HARDWARE_EVENT_COUNT> values_{};
+    std::string error_;
+};
+
+// One counter per line, per emulated frame and per guest instruction, with the host IPC
+[[nodiscard]] std::string format_hardware_counters(const HardwareCounters& counters, uint64_t frames, uint64_t guest_instructions);
+
+}  // namespace WindGB
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace WindGB {
+
+// Mixes a value into a running 64 bits hash (murmur3 finalizer)
+constexpr uint64_t hash_combine(const uint64_t seed, const uint64_t value) {
+    uint64_t x = seed ^ (value + 0x9E3779B97F4A7C15ull + (seed << 6) + (seed >> 2));
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+    x *= 0xC4CEB9FE1A85EC53ull;
+    x ^= x >> 33;
+    return x;
+}
+
+constexpr uint64_t rotl64(const uint64_t x, const int r) { return (x << r) | (x >> (64 - r)); }
+
+// Hashes a byte range 8 bytes at a time (xxHash64 style rounds)
+inline uint64_t hash_bytes(const void* data, const size_t size, const uint64_t seed = 0) {
+    constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ull;
+
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    uint64_t h = seed + PRIME_1 + size;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        h ^= rotl64(word * PRIME_2, 31) * PRIME_1;
+        h = rotl64(h, 27) * PRIME_1 + PRIME_4;
+    }
+    for (; i < size; i++) {
+        h ^= bytes[i] * PRIME_1;
+        h = rotl64(h, 11) * PRIME_2;
+    }
+    return hash_combine(0, h);
+}
+
+}  // namespace WindGB
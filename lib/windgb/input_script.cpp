@@ -0,0 +1,57 @@
+#include "input_script.hpp"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "gameboy.hpp"
+
+namespace WindGB {
+
+// Indexed by JoypadButton
+static constexpr std::array<const char*, 8> BUTTON_NAMES = {"a", "b", "start", "select", "up", "down", "left", "right"};
+
+static uint8_t parse_button(const std::string& name, const size_t line_number) {
+    for (size_t i = 0; i < BUTTON_NAMES.size(); i++) {
+        if (name == BUTTON_NAMES[i]) return 1 << i;
+    }
+    throw std::runtime_error("Input script line " + std::to_string(line_number) + ": unknown button '" + name + "'");
+}
+
+std::vector<InputStep> parse_input_script(std::istream& input) {
+    std::vector<InputStep> steps;
+    std::string line;
+    for (size_t line_number = 1; std::getline(input, line); line_number++) {
+        line = line.substr(0, line.find('#'));
+        std::istringstream fields(line);
+        std::string field;
+        if (!(fields >> field)) continue;
+
+        if (field.size() > 18 || !std::ranges::all_of(field, [](const char c) { return c >= '0' && c <= '9'; })) {
+            throw std::runtime_error("Input script line " + std::to_string(line_number) + ": '" + field + "' is not a frame count");
+        }
+        InputStep step{std::stoull(field), 0};
+        while (fields >> field) step.buttons |= parse_button(field, line_number);
+        steps.push_back(step);
+    }
+    return steps;
+}
+
+uint64_t run_input_script(GameBoy& gameboy, const std::vector<InputStep>& steps) {
+    const GameBoy::Session session(gameboy);
+    const uint64_t first_frame = gameboy.get_ppu().get_frame_count();
+    for (const InputStep& step : steps) {
+        gameboy.get_joypad().set_buttons(step.buttons);
+        const uint64_t end = gameboy.get_ppu().get_frame_count() + step.frames;
+        while (gameboy.get_ppu().get_frame_count() < end) {
+            gameboy.step();
+        }
+        // Frames are not consumed by a display, clear the flag like the frontend does
+        gameboy.get_ppu().mark_frame_consumed();
+    }
+    return gameboy.get_ppu().get_frame_count() - first_frame;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <vector>
+
+namespace WindGB {
+
+class GameBoy;
+
+// Joypad inputs held for a number of frames
+struct InputStep {
+    uint64_t frames;
+    uint8_t buttons;  // Bit n is JoypadButton n
+};
+
+// Input script layout: one "<frames> [button...]" step per line, buttons among a, b, start, select, up, down, left and
+// right, released when none is given. '#' starts a comment. Throws on the first malformed line.
+std::vector<InputStep> parse_input_script(std::istream& input);
+
+// Runs the steps one after the other, a frame ends when the PPU presents it. Returns the frames run.
+uint64_t run_input_script(GameBoy& gameboy, const std::vector<InputStep>& steps);
+
+}  // namespace WindGB
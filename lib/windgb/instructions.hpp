@@ -22,64 +22,64 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 /** LD r16,n16 *******************************************************************************************************/
 [[maybe_unused]] static void In_LD_BC_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD BC, n16
     uint16_t value = cpu.fetch16();
-    cpu.regs.BC = value;
+    cpu.regs().BC = value;
 }
 [[maybe_unused]] static void In_LD_DE_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD DE, n16
     uint16_t value = cpu.fetch16();
-    cpu.regs.DE = value;
+    cpu.regs().DE = value;
 }
 [[maybe_unused]] static void In_LD_HL_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD HL, n16
     uint16_t value = cpu.fetch16();
-    cpu.regs.HL = value;
+    cpu.regs().HL = value;
 }
 [[maybe_unused]] static void In_LD_SP_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD SP, n16
     uint16_t value = cpu.fetch16();
-    cpu.regs.SP = value;
+    cpu.regs().SP = value;
 }
 
 /** LD [r16],A *******************************************************************************************************/
 [[maybe_unused]] static void In_LD_pBC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [BC], A
-    uint8_t data = cpu.regs.A;
-    uint16_t addr = cpu.regs.BC;
+    uint8_t data = cpu.regs().A;
+    uint16_t addr = cpu.regs().BC;
     bus.write(addr, data);
 }
 [[maybe_unused]] static void In_LD_pDE_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [DE], A
-    uint8_t data = cpu.regs.A;
-    uint16_t addr = cpu.regs.DE;
+    uint8_t data = cpu.regs().A;
+    uint16_t addr = cpu.regs().DE;
     bus.write(addr, data);
 }
 [[maybe_unused]] static void In_LD_pHL_plus_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL+], A
-    uint8_t data = cpu.regs.A;
-    uint16_t addr = cpu.regs.HL++;
+    uint8_t data = cpu.regs().A;
+    uint16_t addr = cpu.regs().HL++;
     bus.write(addr, data);
 }
 [[maybe_unused]] static void In_LD_pHL_minus_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL-], A
-    uint8_t data = cpu.regs.A;
-    uint16_t addr = cpu.regs.HL--;
+    uint8_t data = cpu.regs().A;
+    uint16_t addr = cpu.regs().HL--;
     bus.write(addr, data);
 }
 
 /** INC r16 **********************************************************************************************************/
 [[maybe_unused]] static void In_INC_BC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC BC
-    cpu.regs.BC++;
+    cpu.regs().BC++;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_INC_DE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC DE
-    cpu.regs.DE++;
+    cpu.regs().DE++;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_INC_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC HL
-    cpu.regs.HL++;
+    cpu.regs().HL++;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_INC_SP([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC SP
-    cpu.regs.SP++;
+    cpu.regs().SP++;
     bus.cycles(1);
 }
 
 /** INC r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_INC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.A + 1;
 
@@ -91,7 +91,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.A = result;
 }
 [[maybe_unused]] static void In_INC_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.B + 1;
 
@@ -103,7 +103,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.B = result;
 }
 [[maybe_unused]] static void In_INC_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.C + 1;
 
@@ -115,7 +115,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.C = result;
 }
 [[maybe_unused]] static void In_INC_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.D + 1;
 
@@ -127,7 +127,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.D = result;
 }
 [[maybe_unused]] static void In_INC_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.E + 1;
 
@@ -139,7 +139,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.E = result;
 }
 [[maybe_unused]] static void In_INC_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.H + 1;
 
@@ -151,7 +151,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.H = result;
 }
 [[maybe_unused]] static void In_INC_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.L + 1;
 
@@ -164,7 +164,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 [[maybe_unused]] static void In_INC_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // INC [HL]
     // read the value in memory at address HL
-    uint16_t addr = cpu.regs.HL;
+    uint16_t addr = cpu.regs().HL;
     uint8_t value = bus.read(addr);
 
     // Calculate the new value
@@ -174,7 +174,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.write(addr, newValue);
 
     // Update flags
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.set_flag(Registers::Flag::Z, newValue == 0);              // Z: Set if the result is 0
     reg.set_flag(Registers::Flag::N, false);                      // N: Always disabled for INC
     reg.set_flag(Registers::Flag::H, (value & 0x0F) + 1 > 0x0F);  // H: Activated if a bit overflow 3->4
@@ -182,7 +182,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** DEC r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_DEC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.A - 1;
 
@@ -194,7 +194,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.A = result;
 }
 [[maybe_unused]] static void In_DEC_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.B - 1;
 
@@ -206,7 +206,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.B = result;
 }
 [[maybe_unused]] static void In_DEC_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.C - 1;
 
@@ -218,7 +218,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.C = result;
 }
 [[maybe_unused]] static void In_DEC_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.D - 1;
 
@@ -230,7 +230,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.D = result;
 }
 [[maybe_unused]] static void In_DEC_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.E - 1;
 
@@ -242,7 +242,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.E = result;
 }
 [[maybe_unused]] static void In_DEC_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.H - 1;
 
@@ -254,7 +254,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.H = result;
 }
 [[maybe_unused]] static void In_DEC_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t result = reg.L - 1;
 
@@ -266,7 +266,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.L = result;
 }
 [[maybe_unused]] static void In_DEC_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = reg.HL;
 
     uint8_t value = bus.read(addr);
@@ -282,41 +282,41 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 /** LD r8,n8 *********************************************************************************************************/
 [[maybe_unused]] static void In_LD_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.A = value;
+    cpu.regs().A = value;
 }
 [[maybe_unused]] static void In_LD_B_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.B = value;
+    cpu.regs().B = value;
 }
 [[maybe_unused]] static void In_LD_C_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.C = value;
+    cpu.regs().C = value;
 }
 [[maybe_unused]] static void In_LD_D_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.D = value;
+    cpu.regs().D = value;
 }
 [[maybe_unused]] static void In_LD_E_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.E = value;
+    cpu.regs().E = value;
 }
 [[maybe_unused]] static void In_LD_H_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.H = value;
+    cpu.regs().H = value;
 }
 [[maybe_unused]] static void In_LD_L_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, n8
     uint8_t value = cpu.fetch8();
-    cpu.regs.L = value;
+    cpu.regs().L = value;
 }
 [[maybe_unused]] static void In_LD_pHL_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], n8
     uint8_t value = cpu.fetch8();
-    uint16_t addr = cpu.regs.HL;
+    uint16_t addr = cpu.regs().HL;
     bus.write(addr, value);
 }
 
 /** RLCA *************************************************************************************************************/
 [[maybe_unused]] static void In_RLCA([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RLCA
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t& regA = reg.A;
     uint8_t carry = (reg.A & 0x80) >> 7;
 
@@ -332,7 +332,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 /** LD [n16],SP ******************************************************************************************************/
 [[maybe_unused]] static void In_LD_pn16_SP([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [n16], SP
     uint16_t addr = cpu.fetch16();
-    uint16_t regSP = cpu.regs.SP;
+    uint16_t regSP = cpu.regs().SP;
 
     bus.write(addr, regSP & 0xFF);
     bus.write(addr + 1, regSP >> 8);
@@ -340,7 +340,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADD HL,r16 *******************************************************************************************************/
 [[maybe_unused]] static void In_ADD_HL_BC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD HL, BC
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regHL = reg.HL;
     uint16_t regBC = reg.BC;
 
@@ -355,7 +355,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_ADD_HL_DE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD HL, DE
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regHL = reg.HL;
     uint16_t regDE = reg.DE;
 
@@ -370,7 +370,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_ADD_HL_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD HL, HL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regHL = reg.HL;
 
     uint32_t result = regHL + regHL;  // uint32_t to detect overflow
@@ -384,7 +384,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_ADD_HL_SP([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD HL, DE
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regHL = reg.HL;
     uint16_t regSP = reg.SP;
 
@@ -401,25 +401,25 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LD A,[r16] *******************************************************************************************************/
 [[maybe_unused]] static void In_LD_A_pBC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [BC]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = reg.BC;
     uint8_t value = bus.read(addr);
     reg.A = value;
 }
 [[maybe_unused]] static void In_LD_A_pDE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [DE]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = reg.DE;
     uint8_t value = bus.read(addr);
     reg.A = value;
 }
 [[maybe_unused]] static void In_LD_A_pHL_plus([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [HL+]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = reg.HL++;
     uint8_t value = bus.read(addr);
     reg.A = value;
 }
 [[maybe_unused]] static void In_LD_A_pHL_minus([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [HL-]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = reg.HL--;
     uint8_t value = bus.read(addr);
     reg.A = value;
@@ -427,25 +427,25 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** DEC r16 **********************************************************************************************************/
 [[maybe_unused]] static void In_DEC_BC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC BC
-    cpu.regs.BC--;
+    cpu.regs().BC--;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_DEC_DE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC DE
-    cpu.regs.DE--;
+    cpu.regs().DE--;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_DEC_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC HL
-    cpu.regs.HL--;
+    cpu.regs().HL--;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_DEC_SP([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DEC SP
-    cpu.regs.SP--;
+    cpu.regs().SP--;
     bus.cycles(1);
 }
 
 /** RRCA *************************************************************************************************************/
 [[maybe_unused]] static void In_RRCA([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RRCA
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t carry = reg.A & 0x01;
 
     reg.A = (reg.A >> 1) | (carry << 7);
@@ -464,7 +464,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RLA **************************************************************************************************************/
 [[maybe_unused]] static void In_RLA([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RLA
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t oldCarry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
     uint8_t newCarry = (reg.A & 0x80) >> 7;
     reg.A = reg.A << 1 | oldCarry;
@@ -479,14 +479,14 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 /** JR n8 ************************************************************************************************************/
 [[maybe_unused]] static void In_JR_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JR e8
     auto value = static_cast<int8_t>(cpu.fetch8());
-    cpu.regs.PC += value;
+    cpu.regs().PC += value;
 
     bus.cycles(1);
 }
 
 /** RRA **************************************************************************************************************/
 [[maybe_unused]] static void In_RRA([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RRA
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t oldCarry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
     uint8_t newCarry = reg.A & 0x01;
     reg.A = reg.A >> 1 | (oldCarry << 7);
@@ -500,7 +500,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** JR cc,n8 *********************************************************************************************************/
 [[maybe_unused]] static void In_JR_NZ_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JR NZ, e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     auto value = static_cast<int8_t>(cpu.fetch8());
     auto regPC = static_cast<int16_t>(reg.PC);
     if (!reg.get_flag(Registers::Flag::Z)) {
@@ -509,7 +509,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JR_Z_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JR Z, e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     auto value = static_cast<int8_t>(cpu.fetch8());
     if (reg.get_flag(Registers::Flag::Z)) {
         reg.PC = static_cast<uint16_t>(reg.PC + value);
@@ -517,7 +517,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JR_NC_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JR NC, e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     int8_t value = static_cast<int8_t>(cpu.fetch8());
     if (!reg.get_flag(Registers::Flag::C)) {
         reg.PC = static_cast<uint16_t>(reg.PC + value);
@@ -525,7 +525,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JR_C_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JR NC, e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     int8_t value = static_cast<int8_t>(cpu.fetch8());
     if (reg.get_flag(Registers::Flag::C)) {
         reg.PC = static_cast<uint16_t>(reg.PC + value);
@@ -535,7 +535,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** DAA **************************************************************************************************************/
 [[maybe_unused]] static void In_DAA([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DAA
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t adjustment = 0;
     bool setC = false;
     if (reg.get_flag(Registers::Flag::N)) {
@@ -562,7 +562,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** CPL **************************************************************************************************************/
 [[maybe_unused]] static void In_CPL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CPL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = ~reg.A;
 
     // Set flags
@@ -572,7 +572,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SCF **************************************************************************************************************/
 [[maybe_unused]] static void In_SCF([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SCF
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     // Set flags
     reg.set_flag(Registers::Flag::N, false);
@@ -582,7 +582,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** CCF **************************************************************************************************************/
 [[maybe_unused]] static void In_CCF([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CCF
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     bool cFlag = reg.get_flag(Registers::Flag::C) ? false : true;
 
@@ -596,255 +596,255 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 [[maybe_unused]] static void In_LD_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, A
 }
 [[maybe_unused]] static void In_LD_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.B;
 }
 [[maybe_unused]] static void In_LD_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.C;
 }
 [[maybe_unused]] static void In_LD_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.D;
 }
 [[maybe_unused]] static void In_LD_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.E;
 }
 [[maybe_unused]] static void In_LD_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.H;
 }
 [[maybe_unused]] static void In_LD_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = reg.L;
 }
 [[maybe_unused]] static void In_LD_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.A = value;
 }
 
 [[maybe_unused]] static void In_LD_B_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.A;
 }
 [[maybe_unused]] static void In_LD_B_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, B
 }
 [[maybe_unused]] static void In_LD_B_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.C;
 }
 [[maybe_unused]] static void In_LD_B_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.D;
 }
 [[maybe_unused]] static void In_LD_B_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.E;
 }
 [[maybe_unused]] static void In_LD_B_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.H;
 }
 [[maybe_unused]] static void In_LD_B_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
     // LD B, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B = reg.L;
 }
 [[maybe_unused]] static void In_LD_B_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD B, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.B = value;
 }
 
 [[maybe_unused]] static void In_LD_C_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.A;
 }
 [[maybe_unused]] static void In_LD_C_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.B;
 }
 [[maybe_unused]] static void In_LD_C_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, C
 }
 [[maybe_unused]] static void In_LD_C_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.D;
 }
 [[maybe_unused]] static void In_LD_C_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.E;
 }
 [[maybe_unused]] static void In_LD_C_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.H;
 }
 [[maybe_unused]] static void In_LD_C_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C = reg.L;
 }
 [[maybe_unused]] static void In_LD_C_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD C, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.C = value;
 }
 
 [[maybe_unused]] static void In_LD_D_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.A;
 }
 [[maybe_unused]] static void In_LD_D_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.B;
 }
 [[maybe_unused]] static void In_LD_D_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.C;
 }
 [[maybe_unused]] static void In_LD_D_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, D
 }
 [[maybe_unused]] static void In_LD_D_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.E;
 }
 [[maybe_unused]] static void In_LD_D_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.H;
 }
 [[maybe_unused]] static void In_LD_D_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D = reg.L;
 }
 [[maybe_unused]] static void In_LD_D_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD D, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.D = value;
 }
 
 [[maybe_unused]] static void In_LD_E_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.A;
 }
 [[maybe_unused]] static void In_LD_E_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.B;
 }
 [[maybe_unused]] static void In_LD_E_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.C;
 }
 [[maybe_unused]] static void In_LD_E_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.D;
 }
 [[maybe_unused]] static void In_LD_E_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, E
 }
 [[maybe_unused]] static void In_LD_E_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.H;
 }
 [[maybe_unused]] static void In_LD_E_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E = reg.L;
 }
 [[maybe_unused]] static void In_LD_E_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD E, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.E = value;
 }
 
 [[maybe_unused]] static void In_LD_H_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.A;
 }
 [[maybe_unused]] static void In_LD_H_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.B;
 }
 [[maybe_unused]] static void In_LD_H_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.C;
 }
 [[maybe_unused]] static void In_LD_H_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.D;
 }
 [[maybe_unused]] static void In_LD_H_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.E;
 }
 [[maybe_unused]] static void In_LD_H_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, H
 }
 [[maybe_unused]] static void In_LD_H_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H = reg.L;
 }
 [[maybe_unused]] static void In_LD_H_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD H, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.H = value;
 }
 
 [[maybe_unused]] static void In_LD_L_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.A;
 }
 [[maybe_unused]] static void In_LD_L_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.B;
 }
 [[maybe_unused]] static void In_LD_L_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.C;
 }
 [[maybe_unused]] static void In_LD_L_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.D;
 }
 [[maybe_unused]] static void In_LD_L_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.E;
 }
 [[maybe_unused]] static void In_LD_L_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L = reg.H;
 }
 [[maybe_unused]] static void In_LD_L_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, L
 }
 [[maybe_unused]] static void In_LD_L_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD L, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.L = value;
 }
 
 /** LD [HL],r8 *************************************************************************************************************/
 [[maybe_unused]] static void In_LD_pHL_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.A);
 }
 [[maybe_unused]] static void In_LD_pHL_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.B);
 }
 [[maybe_unused]] static void In_LD_pHL_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.C);
 }
 [[maybe_unused]] static void In_LD_pHL_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.D);
 }
 [[maybe_unused]] static void In_LD_pHL_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.E);
 }
 [[maybe_unused]] static void In_LD_pHL_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.H);
 }
 [[maybe_unused]] static void In_LD_pHL_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [HL], L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bus.write(reg.HL, reg.L);
 }
 
@@ -855,7 +855,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADD A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_ADD_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + regA;  // uint16_t to detect overflow
@@ -868,7 +868,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                           // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.B;  // uint16_t to detect overflow
@@ -881,7 +881,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                            // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.C;  // uint16_t to detect overflow
@@ -894,7 +894,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                            // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.D;  // uint16_t to detect overflow
@@ -907,7 +907,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                            // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.E;  // uint16_t to detect overflow
@@ -920,7 +920,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                            // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.H;  // uint16_t to detect overflow
@@ -933,7 +933,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                            // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADD_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA + reg.L;  // uint16_t to detect overflow
@@ -948,7 +948,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADD A,[HL] ******************************************************************************************************/
 [[maybe_unused]] static void In_ADD_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     uint8_t regA = reg.A;
 
@@ -964,7 +964,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADC A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_ADC_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -978,7 +978,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                   // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -992,7 +992,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                    // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1006,7 +1006,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                    // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1020,7 +1020,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                    // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1034,7 +1034,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                    // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1048,7 +1048,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, result > 0xFF);                                    // Carry if overflow on 7 bits
 }
 [[maybe_unused]] static void In_ADC_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1064,7 +1064,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADC A,[HL] ********************************************************************************************************/
 [[maybe_unused]] static void In_ADC_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = bus.read(reg.HL);
@@ -1081,7 +1081,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SUB A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_SUB_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     reg.A = 0;  // Because A - A = 0
 
@@ -1092,7 +1092,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SUB_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.B;  // uint16_t to detect borrow
@@ -1105,7 +1105,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.B);
 }
 [[maybe_unused]] static void In_SUB_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.C;  // uint16_t to detect borrow
@@ -1118,7 +1118,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.C);
 }
 [[maybe_unused]] static void In_SUB_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.D;  // uint16_t to detect borrow
@@ -1131,7 +1131,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.D);
 }
 [[maybe_unused]] static void In_SUB_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.E;  // uint16_t to detect borrow
@@ -1144,7 +1144,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.E);
 }
 [[maybe_unused]] static void In_SUB_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.H;  // uint16_t to detect borrow
@@ -1157,7 +1157,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.H);
 }
 [[maybe_unused]] static void In_SUB_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint16_t result = regA - reg.L;  // uint16_t to detect borrow
@@ -1172,7 +1172,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SUB A,[HL] ******************************************************************************************************/
 [[maybe_unused]] static void In_SUB_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
     uint8_t value = bus.read(reg.HL);
 
@@ -1188,7 +1188,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SBC A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_SBC_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1203,7 +1203,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry != 0);
 }
 [[maybe_unused]] static void In_SBC_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
     uint8_t regB = reg.B;
 
@@ -1218,7 +1218,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < regB + carry);
 }
 [[maybe_unused]] static void In_SBC_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1232,7 +1232,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.C + carry);
 }
 [[maybe_unused]] static void In_SBC_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1246,7 +1246,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.D + carry);
 }
 [[maybe_unused]] static void In_SBC_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1260,7 +1260,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.E + carry);
 }
 [[maybe_unused]] static void In_SBC_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1274,7 +1274,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, regA < reg.H + carry);
 }
 [[maybe_unused]] static void In_SBC_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t carry = reg.get_flag(Registers::Flag::C) ? 1 : 0;
@@ -1290,7 +1290,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SBC A,[HL] ******************************************************************************************************/
 [[maybe_unused]] static void In_SBC_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = bus.read(reg.HL);
@@ -1307,7 +1307,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** AND A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_AND_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     // Flags
     reg.set_flag(Registers::Flag::Z, reg.A == 0);
@@ -1316,7 +1316,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.B;
 
     // Flags
@@ -1326,7 +1326,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.C;
 
     // Flags
@@ -1336,7 +1336,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.D;
 
     // Flags
@@ -1346,7 +1346,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.E;
 
     // Flags
@@ -1356,7 +1356,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.H;
 
     // Flags
@@ -1366,7 +1366,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_AND_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= reg.L;
 
     // Flags
@@ -1378,7 +1378,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** AND A,[HL] ******************************************************************************************************/
 [[maybe_unused]] static void In_AND_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.A &= value;
 
@@ -1391,7 +1391,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** XOR A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_XOR_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A = 0;
 
     // Flags
@@ -1401,7 +1401,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.B;
 
     // Flags
@@ -1411,7 +1411,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.C;
 
     // Flags
@@ -1421,7 +1421,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.D;
 
     // Flags
@@ -1431,7 +1431,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.E;
 
     // Flags
@@ -1441,7 +1441,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.H;
 
     // Flags
@@ -1451,7 +1451,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_XOR_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A ^= reg.L;
 
     // Flags
@@ -1463,7 +1463,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** XOR A,[HL] ******************************************************************************************************/
 [[maybe_unused]] static void In_XOR_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.A ^= value;
 
@@ -1476,7 +1476,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** OR A,r8 *********************************************************************************************************/
 [[maybe_unused]] static void In_OR_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     // Flags
     reg.set_flag(Registers::Flag::Z, reg.A == 0);
@@ -1485,7 +1485,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.B;
 
     // Flags
@@ -1495,7 +1495,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.C;
 
     // Flags
@@ -1505,7 +1505,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.D;
 
     // Flags
@@ -1515,7 +1515,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.E;
 
     // Flags
@@ -1525,7 +1525,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.H;
 
     // Flags
@@ -1535,7 +1535,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_OR_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= reg.L;
 
     // Flags
@@ -1547,7 +1547,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** OR A,[HL] *******************************************************************************************************/
 [[maybe_unused]] static void In_OR_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = bus.read(reg.HL);
     reg.A |= value;
 
@@ -1560,7 +1560,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** CP A,r8 ********************************************************************************************************/
 [[maybe_unused]] static void In_CP_A_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     // Flags
     reg.set_flag(Registers::Flag::Z, true);
@@ -1569,7 +1569,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_CP_A_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, B
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.B;  // uint16_t to detect borrow
 
@@ -1580,7 +1580,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.B > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.C;  // uint16_t to detect borrow
 
@@ -1591,7 +1591,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.C > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, D
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.D;  // uint16_t to detect borrow
 
@@ -1602,7 +1602,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.D > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, E
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.E;  // uint16_t to detect borrow
 
@@ -1613,7 +1613,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.E > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.H;  // uint16_t to detect borrow
 
@@ -1624,7 +1624,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.H > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, L
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t result = reg.A - reg.L;  // uint16_t to detect borrow
 
@@ -1635,7 +1635,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, reg.L > reg.A);
 }
 [[maybe_unused]] static void In_CP_A_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, [HL]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t value = bus.read(reg.HL);
     uint16_t result = reg.A - value;  // uint16_t to detect borrow
@@ -1649,7 +1649,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADD A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_ADD_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = cpu.fetch8();
@@ -1665,7 +1665,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADC A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_ADC_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADC A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = cpu.fetch8();
@@ -1682,7 +1682,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SUB A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_SUB_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SUB A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = cpu.fetch8();
@@ -1698,7 +1698,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SBC A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_SBC_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // SBC A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t regA = reg.A;
 
     uint8_t value = cpu.fetch8();
@@ -1715,7 +1715,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** AND A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_AND_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // AND A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = cpu.fetch8();
     reg.A &= value;
 
@@ -1728,7 +1728,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** XOR A,n8 ********************************************************************************************************/
 [[maybe_unused]] static void In_XOR_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // XOR A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = cpu.fetch8();
     reg.A ^= value;
 
@@ -1741,7 +1741,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** OR A,n8 *********************************************************************************************************/
 [[maybe_unused]] static void In_OR_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // OR A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t value = cpu.fetch8();
     reg.A |= value;
 
@@ -1754,7 +1754,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** CP A,n8 *********************************************************************************************************/
 [[maybe_unused]] static void In_CP_A_n8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CP A, n8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t value = cpu.fetch8();
     uint16_t result = reg.A - value;  // uint16_t to detect borrow
@@ -1768,7 +1768,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RET cc ***********************************************************************************************************/
 [[maybe_unused]] static void In_RET_NZ([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RET NZ
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     if (!reg.get_flag(Registers::Flag::Z)) {
         reg.PC = cpu.pop16();
@@ -1777,7 +1777,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RET_Z([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RET Z
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     if (reg.get_flag(Registers::Flag::Z)) {
         reg.PC = cpu.pop16();
@@ -1786,7 +1786,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RET_NC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RET NC
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     if (!reg.get_flag(Registers::Flag::C)) {
         reg.PC = cpu.pop16();
@@ -1795,7 +1795,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RET_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RET C
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     if (reg.get_flag(Registers::Flag::C)) {
         reg.PC = cpu.pop16();
@@ -1806,22 +1806,22 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RET **************************************************************************************************************/
 [[maybe_unused]] static void In_RET([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RET
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.PC = cpu.pop16();
     bus.cycles(1);
 }
 
 /** RETI *************************************************************************************************************/
 [[maybe_unused]] static void In_RETI([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RETI
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.PC = cpu.pop16();
-    cpu.get_interrupt_handler().ime = true;
+    cpu.get_interrupt_handler().set_ime(true);
     bus.cycles(1);
 }
 
 /** JP cc,n16 ********************************************************************************************************/
 [[maybe_unused]] static void In_JP_NZ_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP NZ, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t value = cpu.fetch16();
 
     if (!reg.get_flag(Registers::Flag::Z)) {
@@ -1830,7 +1830,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JP_Z_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP Z, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t value = cpu.fetch16();
 
     if (reg.get_flag(Registers::Flag::Z)) {
@@ -1839,7 +1839,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JP_NC_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP NC, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t value = cpu.fetch16();
 
     if (!reg.get_flag(Registers::Flag::C)) {
@@ -1848,7 +1848,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_JP_C_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP C, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t value = cpu.fetch16();
 
     if (reg.get_flag(Registers::Flag::C)) {
@@ -1859,7 +1859,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** JP n16 ***********************************************************************************************************/
 [[maybe_unused]] static void In_JP_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t value = cpu.fetch16();
     reg.PC = value;
     bus.cycles(1);
@@ -1867,13 +1867,13 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** JP HL ************************************************************************************************************/
 [[maybe_unused]] static void In_JP_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // JP HL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.PC = reg.HL;
 }
 
 /** CALL cc,n16 ******************************************************************************************************/
 [[maybe_unused]] static void In_CALL_NZ_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CALL NZ, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = cpu.fetch16();
 
     if (!reg.get_flag(Registers::Flag::Z)) {
@@ -1883,7 +1883,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_CALL_Z_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CALL Z, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = cpu.fetch16();
 
     if (reg.get_flag(Registers::Flag::Z)) {
@@ -1893,7 +1893,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_CALL_NC_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CALL NC, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = cpu.fetch16();
 
     if (!reg.get_flag(Registers::Flag::C)) {
@@ -1903,7 +1903,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     }
 }
 [[maybe_unused]] static void In_CALL_C_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CALL C, n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t addr = cpu.fetch16();
 
     if (reg.get_flag(Registers::Flag::C)) {
@@ -1915,7 +1915,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** CALL n16 *********************************************************************************************************/
 [[maybe_unused]] static void In_CALL_n16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // CALL n16
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = cpu.fetch16();
 
@@ -1926,49 +1926,49 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RST vec **********************************************************************************************************/
 [[maybe_unused]] static void In_RST_00H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 00H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x00;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_08H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 08H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x08;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_10H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 10H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x10;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_18H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 18H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x18;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_20H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 20H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x20;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_28H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 28H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x28;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_30H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 30H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x30;
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_RST_38H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // RST 38H
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     cpu.push16(reg.PC);
     reg.PC = 0x38;
     bus.cycles(1);
@@ -1976,7 +1976,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** POP AF ***********************************************************************************************************/
 [[maybe_unused]] static void In_PIn_AF([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // POP AF
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.AF = cpu.pop16();
     reg.F &= 0xF0;  // 4 LSB of F registers need to be always at 0
 
@@ -1989,21 +1989,21 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** POP r16 **********************************************************************************************************/
 [[maybe_unused]] static void In_PIn_BC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // POP BC
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.BC = cpu.pop16();
 }
 [[maybe_unused]] static void In_PIn_DE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // POP DE
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.DE = cpu.pop16();
 }
 [[maybe_unused]] static void In_PIn_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // POP HL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.HL = cpu.pop16();
 }
 
 /** PUSH AF **********************************************************************************************************/
 [[maybe_unused]] static void In_PUSH_AF([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // PUSH AF
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     // Clear the 4 LSB of F register (for security)
     reg.F &= 0xF0;
@@ -2014,19 +2014,19 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** PUSH r16 *********************************************************************************************************/
 [[maybe_unused]] static void In_PUSH_BC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // PUSH BC
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     cpu.push16(reg.BC);
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_PUSH_DE([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // PUSH DE
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     cpu.push16(reg.DE);
     bus.cycles(1);
 }
 [[maybe_unused]] static void In_PUSH_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // PUSH HL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     cpu.push16(reg.HL);
     bus.cycles(1);
@@ -2034,7 +2034,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LDH [C],A ********************************************************************************************************/
 [[maybe_unused]] static void In_LDH_pC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LDH [C], A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = 0xFF00 + reg.C;
     bus.write(addr, reg.A);
@@ -2042,7 +2042,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LDH [n8],A *******************************************************************************************************/
 [[maybe_unused]] static void In_LDH_pn8_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LDH [n8], A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = 0xFF00 + cpu.fetch8();
     bus.write(addr, reg.A);
@@ -2050,7 +2050,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LD [n16],A *******************************************************************************************************/
 [[maybe_unused]] static void In_LD_pn16_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD [n16], A
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = cpu.fetch16();
     bus.write(addr, reg.A);
@@ -2058,7 +2058,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LDH A,[C] ********************************************************************************************************/
 [[maybe_unused]] static void In_LDH_A_pC([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LDH A, [C]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t value = bus.read(0xFF00 + reg.C);
     reg.A = value;
@@ -2066,7 +2066,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LDH A,[n8] *******************************************************************************************************/
 [[maybe_unused]] static void In_LDH_A_pn8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LDH A, [n8]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = 0xFF00 + cpu.fetch8();
     uint8_t value = bus.read(addr);
@@ -2075,7 +2075,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LD A,[n16] ******************************************************************************************************/
 [[maybe_unused]] static void In_LD_A_pn16([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD A, [n16]
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint16_t addr = cpu.fetch16();
     uint8_t value = bus.read(addr);
@@ -2084,7 +2084,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** ADD SP,e8 ********************************************************************************************************/
 [[maybe_unused]] static void In_ADD_SP_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // ADD SP, e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regSP = reg.SP;
 
     int8_t value = static_cast<int8_t>(cpu.fetch8());
@@ -2102,7 +2102,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LD HL,SP+e8 ******************************************************************************************************/
 [[maybe_unused]] static void In_LD_HL_SP_plus_e8([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD HL, SP+e8
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint16_t regSP = reg.SP;
 
     int8_t value = static_cast<int8_t>(cpu.fetch8());
@@ -2120,14 +2120,14 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** LD SP,HL *********************************************************************************************************/
 [[maybe_unused]] static void In_LD_SP_HL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // LD SP, HL
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.SP = reg.HL;
     bus.cycles(1);
 }
 
 /** DI ***************************************************************************************************************/
 [[maybe_unused]] static void In_DI([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {  // DI
-    cpu.get_interrupt_handler().ime = false;
+    cpu.get_interrupt_handler().set_ime(false);
 }
 
 /** EI ***************************************************************************************************************/
@@ -2140,7 +2140,9 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** Invalid **********************************************************************************************************/
 [[maybe_unused]] static void In_Invalid([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    LOG_ERROR("Invalid instruction.");
+    LOG_ERROR("Invalid instruction at 0x{:04X}", static_cast<uint16_t>(cpu.regs().PC - 1));
+    Logger::flush();
+    cpu.get_flight_recorder().write_dump();  // Release builds and hosts without a console sink log nothing
     exit(EXIT_FAILURE);
 }
 
@@ -2149,7 +2151,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 /***********************/
 /** RLC r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_RLC_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.B & 0x80;
     reg.B = (reg.B << 1) | (carry ? 1 : 0);
 
@@ -2160,7 +2162,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.C & 0x80;
     reg.C = (reg.C << 1) | (carry ? 1 : 0);
 
@@ -2171,7 +2173,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.D & 0x80;
     reg.D = (reg.D << 1) | (carry ? 1 : 0);
 
@@ -2182,7 +2184,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.E & 0x80;
     reg.E = (reg.E << 1) | (carry ? 1 : 0);
 
@@ -2193,7 +2195,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.H & 0x80;
     reg.H = (reg.H << 1) | (carry ? 1 : 0);
 
@@ -2204,7 +2206,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.L & 0x80;
     reg.L = (reg.L << 1) | (carry ? 1 : 0);
 
@@ -2215,7 +2217,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool carry = target & 0x80;
     target = (target << 1) | (carry ? 1 : 0);
@@ -2229,7 +2231,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RLC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.A & 0x80;
     reg.A = (reg.A << 1) | (carry ? 1 : 0);
 
@@ -2242,7 +2244,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RRC r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_RRC_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.B & 0x01;
     reg.B = (reg.B >> 1) | (carry << 7);
 
@@ -2253,7 +2255,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.C & 0x01;
     reg.C = (reg.C >> 1) | (carry << 7);
 
@@ -2264,7 +2266,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.D & 0x01;
     reg.D = (reg.D >> 1) | (carry << 7);
 
@@ -2275,7 +2277,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.E & 0x01;
     reg.E = (reg.E >> 1) | (carry << 7);
 
@@ -2286,7 +2288,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.H & 0x01;
     reg.H = (reg.H >> 1) | (carry << 7);
 
@@ -2297,7 +2299,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.L & 0x01;
     reg.L = (reg.L >> 1) | (carry << 7);
 
@@ -2308,7 +2310,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool carry = target & 0x01;
     target = (target >> 1) | (carry << 7);
@@ -2322,7 +2324,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_RRC_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.A & 0x01;
     reg.A = (reg.A >> 1) | (carry << 7);
 
@@ -2335,7 +2337,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RL r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_RL_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.B & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.B = (reg.B << 1) | (carry ? 1 : 0);
@@ -2347,7 +2349,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.C & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.C = (reg.C << 1) | (carry ? 1 : 0);
@@ -2359,7 +2361,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.D & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.D = (reg.D << 1) | (carry ? 1 : 0);
@@ -2371,7 +2373,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.E & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.E = (reg.E << 1) | (carry ? 1 : 0);
@@ -2383,7 +2385,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.H & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.H = (reg.H << 1) | (carry ? 1 : 0);
@@ -2395,7 +2397,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.L & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.L = (reg.L << 1) | (carry ? 1 : 0);
@@ -2407,7 +2409,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool new_carry = target & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
@@ -2422,7 +2424,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RL_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.A & 0x80;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.A = (reg.A << 1) | (carry ? 1 : 0);
@@ -2436,7 +2438,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RR r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_RR_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.B & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.B = (reg.B >> 1) | (carry << 7);
@@ -2448,7 +2450,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.C & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.C = (reg.C >> 1) | (carry << 7);
@@ -2460,7 +2462,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.D & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.D = (reg.D >> 1) | (carry << 7);
@@ -2472,7 +2474,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.E & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.E = (reg.E >> 1) | (carry << 7);
@@ -2484,7 +2486,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.H & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.H = (reg.H >> 1) | (carry << 7);
@@ -2496,7 +2498,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.L & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.L = (reg.L >> 1) | (carry << 7);
@@ -2508,7 +2510,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool new_carry = target & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
@@ -2523,7 +2525,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, new_carry);
 }
 [[maybe_unused]] static void In_RR_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool new_carry = reg.A & 0x01;
     bool carry = reg.get_flag(Registers::Flag::C);
     reg.A = (reg.A >> 1) | (carry << 7);
@@ -2537,7 +2539,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SLA r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_SLA_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.B & 0x80;
     reg.B = (reg.B << 1);
 
@@ -2548,7 +2550,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.C & 0x80;
     reg.C = (reg.C << 1);
 
@@ -2559,7 +2561,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.D & 0x80;
     reg.D = (reg.D << 1);
 
@@ -2570,7 +2572,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.E & 0x80;
     reg.E = (reg.E << 1);
 
@@ -2581,7 +2583,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.H & 0x80;
     reg.H = (reg.H << 1);
 
@@ -2592,7 +2594,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.L & 0x80;
     reg.L = (reg.L << 1);
 
@@ -2603,7 +2605,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool carry = target & 0x80;
     target = (target << 1);
@@ -2617,7 +2619,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SLA_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.A & 0x80;
     reg.A = (reg.A << 1);
 
@@ -2630,7 +2632,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SRA r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_SRA_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.B & 0x01;
     bool signBit = reg.B & 0x80;
 
@@ -2643,7 +2645,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.C & 0x01;
     bool signBit = reg.C & 0x80;
     reg.C = (reg.C >> 1) | (signBit << 7);
@@ -2655,7 +2657,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.D & 0x01;
     bool signBit = reg.D & 0x80;
     reg.D = (reg.D >> 1) | (signBit << 7);
@@ -2667,7 +2669,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.E & 0x01;
     bool signBit = reg.E & 0x80;
     reg.E = (reg.E >> 1) | (signBit << 7);
@@ -2679,7 +2681,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.H & 0x01;
     bool signBit = reg.H & 0x80;
     reg.H = (reg.H >> 1) | (signBit << 7);
@@ -2691,7 +2693,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.L & 0x01;
     bool signBit = reg.L & 0x80;
     reg.L = (reg.L >> 1) | (signBit << 7);
@@ -2703,7 +2705,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool carry = target & 0x01;
     bool signBit = target & 0x80;
@@ -2718,7 +2720,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRA_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.A & 0x01;
     bool signBit = reg.A & 0x80;
     reg.A = (reg.A >> 1) | (signBit << 7);
@@ -2732,7 +2734,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SWAP r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_SWAP_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.B & 0x0F;
     uint8_t high = reg.B & 0xF0;
 
@@ -2745,7 +2747,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.C & 0x0F;
     uint8_t high = reg.C & 0xF0;
 
@@ -2758,7 +2760,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.D & 0x0F;
     uint8_t high = reg.D & 0xF0;
 
@@ -2771,7 +2773,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.E & 0x0F;
     uint8_t high = reg.E & 0xF0;
 
@@ -2784,7 +2786,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.H & 0x0F;
     uint8_t high = reg.H & 0xF0;
 
@@ -2797,7 +2799,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.L & 0x0F;
     uint8_t high = reg.L & 0xF0;
 
@@ -2810,7 +2812,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     uint8_t low = target & 0x0F;
     uint8_t high = target & 0xF0;
@@ -2826,7 +2828,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, false);
 }
 [[maybe_unused]] static void In_SWAP_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t low = reg.A & 0x0F;
     uint8_t high = reg.A & 0xF0;
 
@@ -2841,7 +2843,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** SRL r8 ***********************************************************************************************************/
 [[maybe_unused]] static void In_SRL_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.B & 0x01;
 
     reg.B = (reg.B >> 1);
@@ -2853,7 +2855,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.C & 0x01;
 
     reg.C = (reg.C >> 1);
@@ -2865,7 +2867,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.D & 0x01;
 
     reg.D = (reg.D >> 1);
@@ -2877,7 +2879,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.E & 0x01;
 
     reg.E = (reg.E >> 1);
@@ -2889,7 +2891,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.H & 0x01;
 
     reg.H = (reg.H >> 1);
@@ -2901,7 +2903,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.L & 0x01;
 
     reg.L = (reg.L >> 1);
@@ -2913,7 +2915,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool carry = target & 0x01;
 
@@ -2928,7 +2930,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::C, carry);
 }
 [[maybe_unused]] static void In_SRL_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool carry = reg.A & 0x01;
 
     reg.A = (reg.A >> 1);
@@ -2942,7 +2944,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** BIT b3, r8 *******************************************************************************************************/
 [[maybe_unused]] static void In_BIT_0_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 0);
 
     // Flags
@@ -2951,7 +2953,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 0);
 
     // Flags
@@ -2960,7 +2962,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 0);
 
     // Flags
@@ -2969,7 +2971,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 0);
 
     // Flags
@@ -2978,7 +2980,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 0);
 
     // Flags
@@ -2987,7 +2989,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 0);
 
     // Flags
@@ -2996,7 +2998,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 0);
 
@@ -3006,7 +3008,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_0_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 0);
 
     // Flags
@@ -3016,7 +3018,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_1_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 1);
 
     // Flags
@@ -3025,7 +3027,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 1);
 
     // Flags
@@ -3034,7 +3036,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 1);
 
     // Flags
@@ -3043,7 +3045,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 1);
 
     // Flags
@@ -3052,7 +3054,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 1);
 
     // Flags
@@ -3061,7 +3063,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 1);
 
     // Flags
@@ -3070,7 +3072,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 1);
 
@@ -3080,7 +3082,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_1_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 1);
 
     // Flags
@@ -3090,7 +3092,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_2_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 2);
 
     // Flags
@@ -3099,7 +3101,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 2);
 
     // Flags
@@ -3108,7 +3110,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 2);
 
     // Flags
@@ -3117,7 +3119,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 2);
 
     // Flags
@@ -3126,7 +3128,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 2);
 
     // Flags
@@ -3135,7 +3137,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 2);
 
     // Flags
@@ -3144,7 +3146,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 2);
 
@@ -3154,7 +3156,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_2_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 2);
 
     // Flags
@@ -3164,7 +3166,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_3_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 3);
 
     // Flags
@@ -3173,7 +3175,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 3);
 
     // Flags
@@ -3182,7 +3184,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 3);
 
     // Flags
@@ -3191,7 +3193,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 3);
 
     // Flags
@@ -3200,7 +3202,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 3);
 
     // Flags
@@ -3209,7 +3211,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 3);
 
     // Flags
@@ -3218,7 +3220,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 3);
 
@@ -3228,7 +3230,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_3_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 3);
 
     // Flags
@@ -3238,7 +3240,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_4_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 4);
 
     // Flags
@@ -3247,7 +3249,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 4);
 
     // Flags
@@ -3256,7 +3258,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 4);
 
     // Flags
@@ -3265,7 +3267,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 4);
 
     // Flags
@@ -3274,7 +3276,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 4);
 
     // Flags
@@ -3283,7 +3285,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 4);
 
     // Flags
@@ -3292,7 +3294,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 4);
 
@@ -3302,7 +3304,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_4_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 4);
 
     // Flags
@@ -3312,7 +3314,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_5_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 5);
 
     // Flags
@@ -3321,7 +3323,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 5);
 
     // Flags
@@ -3330,7 +3332,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 5);
 
     // Flags
@@ -3339,7 +3341,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 5);
 
     // Flags
@@ -3348,7 +3350,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 5);
 
     // Flags
@@ -3357,7 +3359,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 5);
 
     // Flags
@@ -3366,7 +3368,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 5);
 
@@ -3376,7 +3378,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_5_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 5);
 
     // Flags
@@ -3386,7 +3388,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_6_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 6);
 
     // Flags
@@ -3395,7 +3397,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 6);
 
     // Flags
@@ -3404,7 +3406,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 6);
 
     // Flags
@@ -3413,7 +3415,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 6);
 
     // Flags
@@ -3422,7 +3424,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 6);
 
     // Flags
@@ -3431,7 +3433,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 6);
 
     // Flags
@@ -3440,7 +3442,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 6);
 
@@ -3450,7 +3452,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_6_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 6);
 
     // Flags
@@ -3460,7 +3462,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 }
 
 [[maybe_unused]] static void In_BIT_7_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.B & (1 << 7);
 
     // Flags
@@ -3469,7 +3471,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.C & (1 << 7);
 
     // Flags
@@ -3478,7 +3480,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.D & (1 << 7);
 
     // Flags
@@ -3487,7 +3489,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.E & (1 << 7);
 
     // Flags
@@ -3496,7 +3498,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.H & (1 << 7);
 
     // Flags
@@ -3505,7 +3507,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.L & (1 << 7);
 
     // Flags
@@ -3514,7 +3516,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     bool result = target & (1 << 7);
 
@@ -3524,7 +3526,7 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     reg.set_flag(Registers::Flag::H, true);
 }
 [[maybe_unused]] static void In_BIT_7_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     bool result = reg.A & (1 << 7);
 
     // Flags
@@ -3535,103 +3537,103 @@ extern std::array<Instruction, 256> prefix_instruction_table;
 
 /** RES b3, r8 *******************************************************************************************************/
 [[maybe_unused]] static void In_RES_0_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 0);
 }
 [[maybe_unused]] static void In_RES_0_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 0);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_0_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 0);
 }
 
 [[maybe_unused]] static void In_RES_1_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 1);
 }
 [[maybe_unused]] static void In_RES_1_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 1);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_1_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 1);
 }
 
 [[maybe_unused]] static void In_RES_2_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 2);
 }
 [[maybe_unused]] static void In_RES_2_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 2);
@@ -3639,38 +3641,38 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_2_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 2);
 
     ;
 }
 
 [[maybe_unused]] static void In_RES_3_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 3);
 }
 [[maybe_unused]] static void In_RES_3_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 3);
@@ -3678,291 +3680,291 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_3_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 3);
 }
 
 [[maybe_unused]] static void In_RES_4_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 4);
 }
 [[maybe_unused]] static void In_RES_4_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 4);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_4_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 4);
 }
 
 [[maybe_unused]] static void In_RES_5_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 5);
 }
 [[maybe_unused]] static void In_RES_5_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 5);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_5_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 5);
 }
 
 [[maybe_unused]] static void In_RES_6_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 6);
 }
 [[maybe_unused]] static void In_RES_6_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 6);
 
     ;
 }
 [[maybe_unused]] static void In_RES_6_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 6);
 }
 [[maybe_unused]] static void In_RES_6_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 6);
 }
 [[maybe_unused]] static void In_RES_6_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 6);
 }
 [[maybe_unused]] static void In_RES_6_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 6);
 }
 [[maybe_unused]] static void In_RES_6_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 6);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_6_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 6);
 }
 
 [[maybe_unused]] static void In_RES_7_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L &= ~(1 << 7);
 }
 [[maybe_unused]] static void In_RES_7_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target &= ~(1 << 7);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_RES_7_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A &= ~(1 << 7);
 }
 
 /** SET b3, r8 *******************************************************************************************************/
 [[maybe_unused]] static void In_SET_0_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 0);
 }
 [[maybe_unused]] static void In_SET_0_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 0);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_0_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 0);
 }
 
 [[maybe_unused]] static void In_SET_1_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 1);
 }
 [[maybe_unused]] static void In_SET_1_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 1);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_1_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 1);
 }
 
 [[maybe_unused]] static void In_SET_2_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 2);
 }
 [[maybe_unused]] static void In_SET_2_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 2);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_2_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 2);
 }
 
 [[maybe_unused]] static void In_SET_3_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 3);
 }
 [[maybe_unused]] static void In_SET_3_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
 
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 3);
@@ -3970,151 +3972,151 @@ extern std::array<Instruction, 256> prefix_instruction_table;
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_3_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 3);
 }
 
 [[maybe_unused]] static void In_SET_4_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 4);
 }
 [[maybe_unused]] static void In_SET_4_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 4);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_4_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 4);
 }
 
 [[maybe_unused]] static void In_SET_5_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 5);
 }
 [[maybe_unused]] static void In_SET_5_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 5);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_5_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 5);
 }
 
 [[maybe_unused]] static void In_SET_6_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 6);
 }
 [[maybe_unused]] static void In_SET_6_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 6);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_6_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 6);
 }
 
 [[maybe_unused]] static void In_SET_7_B([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.B |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_C([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.C |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_D([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.D |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_E([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.E |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_H([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.H |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_L([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.L |= (1 << 7);
 }
 [[maybe_unused]] static void In_SET_7_pHL([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     uint8_t target = bus.read(reg.HL);
     target |= (1 << 7);
 
     bus.write(reg.HL, target);
 }
 [[maybe_unused]] static void In_SET_7_A([[maybe_unused]] CPU& cpu, [[maybe_unused]] Bus& bus) {
-    auto& reg = cpu.regs;
+    auto& reg = cpu.regs();
     reg.A |= (1 << 7);
 }
 
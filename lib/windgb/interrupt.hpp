@@ -2,25 +2,29 @@
 
 #include <cstdint>
 
-namespace WindGB {
+#include "common.hpp"
+#include "machine_state.hpp"
 
-class Bus;
-class IO;
+namespace WindGB {
 
 class InterruptHandler {
    public:
-    explicit InterruptHandler(Bus& bus, IO& io);
+    explicit InterruptHandler(MachineState& state) : state_(&state) {}
+
+    // Points the handler to the state of another machine, after a copy
+    void link(MachineState& state) { state_ = &state; }
 
     [[nodiscard]] bool has_pending() const;
     [[nodiscard]] uint8_t get_next_pending() const;
     void clear_flag(uint8_t id);
 
-    bool ime = false;
+    [[nodiscard]] bool ime() const { return state_->ime; }
+    void set_ime(const bool enabled) { state_->ime = enabled; }
 
    private:
-    Bus& bus_;
+    MachineState* state_;
 
-    uint8_t& if_;
+    uint8_t& interrupt_flags() const { return state_->io[REG_IF_ADDR - IO_ADDR_START]; }
 };
 
-}  // namespace WindGB
\ No newline at end of file
+}  // namespace WindGB
@@ -1,29 +1,30 @@
 #include "io.hpp"
 
 #include "common.hpp"
+#include "hash.hpp"
 #include "logger.hpp"
 
 namespace WindGB {
 
-IO::IO() {
-    joypad_ = std::make_unique<Joypad>();
-    assert(joypad_);
+uint64_t IO::hash_state() const {
+    const uint64_t joypad = joypad_.get_buttons() | (joypad_.get_output() << 8);
+    return hash_combine(hash_bytes(state_->io.data(), state_->io.size()), joypad);
 }
 
 uint8_t IO::read(const uint16_t addr) const {
     const uint16_t index = addr - IO_ADDR_START;
     if (addr == 0xFF00) {
-        return joypad_->get_output();
+        return joypad_.get_output();
     }
-    return data_[index];
+    return state_->io[index];
 }
 
 void IO::write(const uint16_t addr, const uint8_t data) {
     const uint16_t index = addr - IO_ADDR_START;
     if (addr == 0xFF00) {
-        joypad_->set_sel(data);
+        joypad_.set_sel(data);
     } else {
-        data_[index] = data;
+        state_->io[index] = data;
     }
 }
 
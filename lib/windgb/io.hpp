@@ -2,25 +2,32 @@
 
 #include <array>
 #include <cstdint>
-#include <memory>
 
 #include "component.hpp"
 #include "joypad.hpp"
+#include "machine_state.hpp"
 
 namespace WindGB {
 
 class IO final : public Component {
    public:
-    IO();
+    explicit IO(MachineState& state) : state_(&state), joypad_(state.joypad) {}
+    // Points the registers and the joypad to the state of another machine, after a copy
+    void link(MachineState& state) {
+        state_ = &state;
+        joypad_.link(state.joypad);
+    }
+
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
-    uint8_t* get_data() { return data_.data(); }
+    uint8_t* get_data() { return state_->io.data(); }
+    [[nodiscard]] uint64_t hash_state() const;
 
-    Joypad* get_joypad() { return joypad_.get(); }
+    Joypad* get_joypad() { return &joypad_; }
 
    private:
-    std::unique_ptr<Joypad> joypad_;
-    std::array<uint8_t, 0x80> data_ = {0};
+    MachineState* state_;
+    Joypad joypad_;
 };
 
 }  // namespace WindGB
\ No newline at end of file
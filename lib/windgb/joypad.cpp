@@ -5,66 +5,92 @@ namespace WindGB {
 uint8_t Joypad::get_output() const {
     uint8_t res = 0xCF;
 
-    if (!state_.button) {  // Buttons active
-        if (state_.a) res &= ~0x01;
-        if (state_.b) res &= ~0x02;
-        if (state_.select) res &= ~0x04;
-        if (state_.start) res &= ~0x08;
+    if (!state_->button) {  // Buttons active
+        if (state_->a) res &= ~0x01;
+        if (state_->b) res &= ~0x02;
+        if (state_->select) res &= ~0x04;
+        if (state_->start) res &= ~0x08;
     }
 
-    if (!state_.dpad) {  // D-PAD active
-        if (state_.right) res &= ~0x01;
-        if (state_.left) res &= ~0x02;
-        if (state_.up) res &= ~0x04;
-        if (state_.down) res &= ~0x08;
+    if (!state_->dpad) {  // D-PAD active
+        if (state_->right) res &= ~0x01;
+        if (state_->left) res &= ~0x02;
+        if (state_->up) res &= ~0x04;
+        if (state_->down) res &= ~0x08;
     }
 
     return res;
 }
 
 void Joypad::set_sel(const uint8_t data) {
-    state_.button = data & 0x20;
-    state_.dpad = data & 0x10;
+    state_->button = data & 0x20;
+    state_->dpad = data & 0x10;
 }
 void Joypad::set_button(const JoypadButton button, const bool state) {
-    last_reg_state_ = get_output();
+    state_->last_reg_state = get_output();
     switch (button) {
         case JoypadButton::A:
-            state_.a = state;
+            state_->a = state;
             break;
         case JoypadButton::B:
-            state_.b = state;
+            state_->b = state;
             break;
         case JoypadButton::START:
-            state_.start = state;
+            state_->start = state;
             break;
         case JoypadButton::SELECT:
-            state_.select = state;
+            state_->select = state;
             break;
         case JoypadButton::UP:
-            state_.up = state;
+            state_->up = state;
             break;
         case JoypadButton::DOWN:
-            state_.down = state;
+            state_->down = state;
             break;
         case JoypadButton::LEFT:
-            state_.left = state;
+            state_->left = state;
             break;
         case JoypadButton::RIGHT:
-            state_.right = state;
+            state_->right = state;
             break;
         default:
             break;
     }
 }
 
+uint8_t Joypad::get_buttons() const {
+    const bool states[] = {state_->a, state_->b, state_->start, state_->select, state_->up, state_->down, state_->left, state_->right};
+
+    uint8_t buttons = 0;
+    for (int i = 0; i < 8; i++) {
+        if (states[i]) buttons |= 1 << i;
+    }
+    return buttons;
+}
+
+void Joypad::set_buttons(const uint8_t buttons) {
+    if (buttons == get_buttons()) return;
+
+    // Compared as a whole with the output, so that every edge of the change raises the interrupt
+    const uint8_t old_output = get_output();
+    state_->a = buttons & (1 << static_cast<int>(JoypadButton::A));
+    state_->b = buttons & (1 << static_cast<int>(JoypadButton::B));
+    state_->start = buttons & (1 << static_cast<int>(JoypadButton::START));
+    state_->select = buttons & (1 << static_cast<int>(JoypadButton::SELECT));
+    state_->up = buttons & (1 << static_cast<int>(JoypadButton::UP));
+    state_->down = buttons & (1 << static_cast<int>(JoypadButton::DOWN));
+    state_->left = buttons & (1 << static_cast<int>(JoypadButton::LEFT));
+    state_->right = buttons & (1 << static_cast<int>(JoypadButton::RIGHT));
+    state_->last_reg_state = old_output;
+}
+
 bool Joypad::is_button_released() {
     const uint8_t new_reg = get_output();
 
     // Handle interrupt
     for (int i = 0; i < 4; i++) {
-        if ((new_reg & (1 << i)) && !(last_reg_state_ & (1 << i))) {
-            last_reg_state_ = new_reg;
+        if ((new_reg & (1 << i)) && !(state_->last_reg_state & (1 << i))) {
+            state_->last_reg_state = new_reg;
             return true;
         }
     }
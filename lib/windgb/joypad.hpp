@@ -1,6 +1,7 @@
 #pragma once
 
-#include <atomic>
+#include <cstdint>
+
 
 namespace WindGB {
 
@@ -15,25 +16,34 @@ enum class JoypadButton {
     RIGHT,
 };
 
+// Part of the machine state, written on the emulation thread only
 struct JoypadState {
-    bool dpad, button;
-    std::atomic<bool> a, b, start, select;
-    std::atomic<bool> up, down, left, right;
+    bool dpad = false, button = false;
+    bool a = false, b = false, start = false, select = false;
+    bool up = false, down = false, left = false, right = false;
+    uint8_t last_reg_state = 0xCF;  // Output the release interrupt compares against
 };
 
 class Joypad {
    public:
+    explicit Joypad(JoypadState& state) : state_(&state) {}
+    // Points to the state of another machine, after a copy
+    void link(JoypadState& state) { state_ = &state; }
+
     [[nodiscard]] uint8_t get_output() const;
-    JoypadState& get_state() { return state_; }
+    JoypadState& get_state() { return *state_; }
 
     void set_sel(uint8_t data);
     void set_button(JoypadButton button, bool state);
 
+    // Pressed buttons as a mask, bit n is JoypadButton n
+    [[nodiscard]] uint8_t get_buttons() const;
+    void set_buttons(uint8_t buttons);
+
     [[nodiscard]] bool is_button_released();
 
    private:
-    std::atomic<uint8_t> last_reg_state_ = 0xCF;
-    JoypadState state_ = {};
+    JoypadState* state_;
 };
 
 }  // namespace WindGB
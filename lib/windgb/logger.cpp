@@ -1,12 +1,17 @@
 #include "logger.hpp"
 
+#include <spdlog/async.h>
 #include <spdlog/common.h>
 #include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/null_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace WindGB {
 
+static constexpr size_t ASYNC_QUEUE_SIZE = 8192;  // Messages, the oldest ones are overwritten when it is full
+
 std::shared_ptr<spdlog::logger> g_logger = nullptr;
+thread_local spdlog::logger* Logger::current_ = nullptr;
 
 void Logger::init(const std::string& path) {
     if (g_logger != nullptr) {
@@ -14,6 +19,12 @@ void Logger::init(const std::string& path) {
         return;
     }
 
+    g_logger = create("Luma logger", path);
+
+    LOG_INFO("Logger initialized.");
+}
+
+std::shared_ptr<spdlog::logger> Logger::create(const std::string& name, const std::string& path) {
     // Configure sinks
     std::vector<spdlog::sink_ptr> sinks;
 
@@ -31,17 +42,25 @@ void Logger::init(const std::string& path) {
         sinks.push_back(file_sink);
     }
 
-    g_logger = std::make_shared<spdlog::logger>("Luma logger", sinks.begin(), sinks.end());
+    // The emulation thread only enqueues the message, it never waits for the sinks
+    static const auto thread_pool = std::make_shared<spdlog::details::thread_pool>(ASYNC_QUEUE_SIZE, 1);
+    auto logger = std::make_shared<spdlog::async_logger>(name, sinks.begin(), sinks.end(), thread_pool, spdlog::async_overflow_policy::overrun_oldest);
+    logger->flush_on(spdlog::level::err);
+    return logger;
+}
 
-    LOG_INFO("Logger initialized.");
+void Logger::flush() {
+    if (current_) current_->flush();
+    if (g_logger) g_logger->flush();
 }
 
-spdlog::logger& Logger::get() {
+spdlog::logger& Logger::get_default() {
     if (g_logger == nullptr) {
-        throw std::runtime_error("Trying to get an initialized logger.");
+        static spdlog::logger null_logger("null", std::make_shared<spdlog::sinks::null_sink_mt>());
+        return null_logger;
     }
 
     return *g_logger;
 }
 
-}  // namespace WindGB
\ No newline at end of file
+}  // namespace WindGB
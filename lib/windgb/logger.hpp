@@ -2,20 +2,122 @@
 
 #include <spdlog/spdlog.h>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// Compile-time minimum level, the calls below it are removed with their arguments
+#define WINDGB_LOG_LEVEL_TRACE 0
+#define WINDGB_LOG_LEVEL_DEBUG 1
+#define WINDGB_LOG_LEVEL_INFO 2
+#define WINDGB_LOG_LEVEL_WARN 3
+#define WINDGB_LOG_LEVEL_ERROR 4
+#define WINDGB_LOG_LEVEL_CRITICAL 5
+#define WINDGB_LOG_LEVEL_OFF 6
+
+#ifndef WINDGB_LOG_LEVEL
+#define WINDGB_LOG_LEVEL WINDGB_LOG_LEVEL_TRACE
+#endif
+
 namespace WindGB {
 
 class Logger {
    public:
+    // Creates the default logger, messages are formatted and written by a background thread
     static void init(const std::string& path = {});
+    // Creates a logger with the same sinks configuration, to give an emulator instance its own output
+    static std::shared_ptr<spdlog::logger> create(const std::string& name, const std::string& path = {});
+    // Writes the queued messages
+    static void flush();
+
+    // Logger of the current thread: the one of the active Scope, else the default one, else a logger discarding everything
+    static spdlog::logger& get() { return current_ ? *current_ : get_default(); }
+
+    // Routes the messages of the current thread to a logger while it is alive, nullptr keeps the current one
+    class Scope {
+       public:
+        explicit Scope(spdlog::logger* logger) : previous_(current_) {
+            if (logger) current_ = logger;
+        }
+        ~Scope() { current_ = previous_; }
 
-    static spdlog::logger& get();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+       private:
+        spdlog::logger* previous_;
+    };
+
+   private:
+    static thread_local spdlog::logger* current_;
+
+    static spdlog::logger& get_default();
+};
+
+// Lets the first BURST messages of a call site through, then only the 2^n-th ones
+class LogRateLimiter {
+   public:
+    static constexpr uint64_t BURST = 8;
+
+    bool allow() {
+        const uint64_t count = count_.fetch_add(1, std::memory_order_relaxed) + 1;
+        return count <= BURST || (count & (count - 1)) == 0;
+    }
+    [[nodiscard]] uint64_t get_count() const { return count_.load(std::memory_order_relaxed); }
+
+   private:
+    std::atomic<uint64_t> count_ = 0;
 };
 
 }  // namespace WindGB
 
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_TRACE
 #define LOG_TRACE(...) ::WindGB::Logger::get().trace(__VA_ARGS__)
+#else
+#define LOG_TRACE(...) ((void)0)
+#endif
+
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_DEBUG
 #define LOG_DEBUG(...) ::WindGB::Logger::get().debug(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) ((void)0)
+#endif
+
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_INFO
 #define LOG_INFO(...) ::WindGB::Logger::get().info(__VA_ARGS__)
+#else
+#define LOG_INFO(...) ((void)0)
+#endif
+
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_WARN
 #define LOG_WARN(...) ::WindGB::Logger::get().warn(__VA_ARGS__)
+#else
+#define LOG_WARN(...) ((void)0)
+#endif
+
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_ERROR
 #define LOG_ERROR(...) ::WindGB::Logger::get().error(__VA_ARGS__)
-#define LOG_CRITICAL(...) ::WindGB::Logger::get().critical(__VA_ARGS__)
\ No newline at end of file
+#else
+#define LOG_ERROR(...) ((void)0)
+#endif
+
+#if WINDGB_LOG_LEVEL <= WINDGB_LOG_LEVEL_CRITICAL
+#define LOG_CRITICAL(...) ::WindGB::Logger::get().critical(__VA_ARGS__)
+#else
+#define LOG_CRITICAL(...) ((void)0)
+#endif
+
+// For the emulation paths a ROM can hit on every access
+#define LOG_RATE_LIMITED(LOG_MACRO, ...)                                                                  \
+    do {                                                                                                  \
+        static ::WindGB::LogRateLimiter log_limiter_;                                                     \
+        if (log_limiter_.allow()) {                                                                       \
+            LOG_MACRO(__VA_ARGS__);                                                                       \
+            if (log_limiter_.get_count() == ::WindGB::LogRateLimiter::BURST) {                            \
+                LOG_MACRO("Message repeated {} times, only the 2^n-th occurrences are logged from now on", \
+                          ::WindGB::LogRateLimiter::BURST);                                               \
+            }                                                                                             \
+        }                                                                                                 \
+    } while (0)
+#define LOG_WARN_LIMITED(...) LOG_RATE_LIMITED(LOG_WARN, __VA_ARGS__)
+#define LOG_ERROR_LIMITED(...) LOG_RATE_LIMITED(LOG_ERROR, __VA_ARGS__)
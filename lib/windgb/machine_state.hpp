@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "joypad.hpp"
+#include "registers.hpp"
+
+namespace WindGB {
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+// Registers, scheduling state, joypad, IO and HRAM: the part of the machine state that snapshots always copy, by assignment.
+// The registers and the scheduling state touched at every bus cycle fill the first cache line.
+struct alignas(CACHE_LINE_SIZE) CoreState {
+    static constexpr uint64_t NEVER = std::numeric_limits<uint64_t>::max();
+
+    // CPU
+    Registers regs;
+    bool ime = false;
+    bool request_ime_en = false;
+    bool halted = false;
+    bool halt_bug = false;
+
+    // Bus and scheduler, in bus ticks (M-cycles)
+    uint64_t tick = 0;
+    uint64_t timer_next_event = NEVER;  // TIMA overflow
+    uint64_t ppu_next_event = NEVER;
+    uint8_t ie = 0;
+    bool boot_rom_enabled = true;
+    bool dma_active = false;
+    uint8_t dma_cycles_remaining = 0;
+    uint16_t dma_src_addr = 0;
+    uint64_t timer_last_sync = 0;  // Tick TIMA is up to date with
+    uint64_t ppu_last_sync = 0;
+
+    uint64_t div_base = 0;  // Tick of the last internal DIV counter reset
+    JoypadState joypad;
+
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, 0x80> io{};
+    std::array<uint8_t, 0x7F> hram{};
+};
+
+// Mutable machine state in one block owned by the GameBoy, the components read it at fixed offsets through a pointer.
+// The memories follow the core state, snapshots copy them page by page. Copying it is a memcpy. The caches derived
+// from it and the cartridge stay in their components, as does the PPU timing and pixel pipeline state (mode, dot
+// counters, FIFOs, frame count): it is copied with the PPU, whose scanline engine it drives.
+struct alignas(CACHE_LINE_SIZE) MachineState : CoreState {
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, 0xA0> oam{};
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, 0x2000> wram{};
+    alignas(CACHE_LINE_SIZE) std::array<uint8_t, 0x2000> vram{};
+};
+
+static_assert(std::is_trivially_copyable_v<MachineState>);
+static_assert(offsetof(CoreState, ppu_last_sync) + sizeof(uint64_t) <= CACHE_LINE_SIZE, "The hot state must fit in the first cache line");
+
+}  // namespace WindGB
@@ -5,7 +5,7 @@
 
 namespace WindGB {
 
-std::unique_ptr<MBC> MBC::create(const std::vector<uint8_t>& rom, const uint8_t cartridge_type, uint8_t ram_size) {
+std::unique_ptr<MBC> MBC::create(const RomData& rom, const uint8_t cartridge_type, uint8_t ram_size) {
     switch (cartridge_type) {
         case 0x00:  // ROM ONLY
             return nullptr;
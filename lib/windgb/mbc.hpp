@@ -5,10 +5,15 @@
 #include <memory>
 #include <vector>
 
+#include "dirty.hpp"
+
 namespace WindGB {
 
 constexpr std::array<uint8_t, 6> RAM_SIZE_KIB = {0, 2, 8, 32, 128, 64};
 
+// ROM image, shared by the copies of a cartridge
+using RomData = std::shared_ptr<const std::vector<uint8_t>>;
+
 class MBC {
    public:
     virtual ~MBC() = default;
@@ -16,7 +21,51 @@ class MBC {
     [[nodiscard]] virtual uint8_t read(uint16_t addr) const = 0;
     virtual void write(uint16_t addr, uint8_t data) = 0;
 
-    static std::unique_ptr<MBC> create(const std::vector<uint8_t>& rom, uint8_t cartridge_type, uint8_t ram_size);
+    // Bank mapped at 0x4000-0x7FFF
+    [[nodiscard]] virtual uint16_t get_rom_bank() const = 0;
+
+    // Hash of the RAM and of the banking registers
+    [[nodiscard]] virtual uint64_t hash_state() const = 0;
+
+    using RamPages = PageTracker<128 * 1024 / PAGE_SIZE>;
+    [[nodiscard]] RamPages& get_ram_pages() { return ram_pages_; }
+
+    // Copies the banking state and the RAM into target, reusing its allocation when it is the same kind of MBC. Only the
+    // RAM pages set in pages are copied when given and target has the same RAM size. Returns the bytes of RAM copied.
+    virtual size_t copy_to(std::unique_ptr<MBC>& target, const RamPages::Bitmap* pages = nullptr) const = 0;
+
+    static std::unique_ptr<MBC> create(const RomData& rom, uint8_t cartridge_type, uint8_t ram_size);
+
+   protected:
+    std::vector<uint8_t> ram_;
+    RamPages ram_pages_;
+
+    MBC() = default;
+    MBC(const MBC&) = default;
+    // Leaves the RAM to copy_as, the subclasses only assign their banking registers
+    MBC& operator=(const MBC&) { return *this; }
+
+    void write_ram(const uint32_t addr, const uint8_t data) {
+        ram_[addr] = data;
+        ram_pages_.mark(addr / PAGE_SIZE);
+    }
+
+    template <typename T>
+    static size_t copy_as(const T& source, std::unique_ptr<MBC>& target, const RamPages::Bitmap* pages) {
+        auto* mbc = dynamic_cast<T*>(target.get());
+        if (!mbc) {
+            target = std::make_unique<T>(source);
+            return source.ram_.size();
+        }
+
+        *mbc = source;
+        if (pages && mbc->ram_.size() == source.ram_.size()) {
+            return copy_pages(source.ram_.data(), mbc->ram_.data(), source.ram_.size(), *pages, &mbc->ram_pages_);
+        }
+        mbc->ram_ = source.ram_;
+        mbc->ram_pages_ = source.ram_pages_;
+        return source.ram_.size();
+    }
 };
 
 }  // namespace WindGB
\ No newline at end of file
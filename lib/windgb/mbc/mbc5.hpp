@@ -6,14 +6,16 @@ namespace WindGB {
 
 class MBC5 final : public MBC {
    public:
-    explicit MBC5(const std::vector<uint8_t>& rom, uint8_t ram_size_index = 0, bool battery = false);
+    explicit MBC5(RomData rom, uint8_t ram_size_index = 0, bool battery = false);
 
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
+    [[nodiscard]] uint16_t get_rom_bank() const override { return rom_bank(); }
+    [[nodiscard]] uint64_t hash_state() const override;
+    size_t copy_to(std::unique_ptr<MBC>& target, const RamPages::Bitmap* pages) const override { return copy_as(*this, target, pages); }
 
    private:
-    const std::vector<uint8_t>& rom_;
-    std::vector<uint8_t> ram_;
+    RomData rom_;
     uint16_t rom_bank_low_ = 1;
     uint16_t rom_bank_high_ = 0;
     uint8_t ram_bank_ = 0;
@@ -0,0 +1,259 @@
+#include "memory_stats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+#include "common.hpp"
+
+namespace WindGB {
+
+const char* memory_access_name(const MemoryAccess access) {
+    switch (access) {
+        case MemoryAccess::READ:
+            return "read";
+        case MemoryAccess::WRITE:
+            return "write";
+        case MemoryAccess::FETCH:
+            return "fetch";
+        case MemoryAccess::DIRECT_READ:
+            return "direct_read";
+        default:
+            return "unknown";
+    }
+}
+
+static std::string io_register_name(const uint16_t addr) {
+    switch (addr) {
+        case REG_JOYP_ADDR:
+            return "JOYP";
+        case REG_SB_ADDR:
+            return "SB";
+        case REG_SC_ADDR:
+            return "SC";
+        case REG_DIV_ADDR:
+            return "DIV";
+        case REG_TIMA_ADDR:
+            return "TIMA";
+        case REG_TMA_ADDR:
+            return "TMA";
+        case REG_TAC_ADDR:
+            return "TAC";
+        case REG_IF_ADDR:
+            return "IF";
+        case REG_NR10_ADDR:
+            return "NR10";
+        case REG_NR11_ADDR:
+            return "NR11";
+        case REG_NR12_ADDR:
+            return "NR12";
+        case REG_NR13_ADDR:
+            return "NR13";
+        case REG_NR14_ADDR:
+            return "NR14";
+        case REG_NR21_ADDR:
+            return "NR21";
+        case REG_NR22_ADDR:
+            return "NR22";
+        case REG_NR23_ADDR:
+            return "NR23";
+        case REG_NR24_ADDR:
+            return "NR24";
+        case REG_NR30_ADDR:
+            return "NR30";
+        case REG_NR31_ADDR:
+            return "NR31";
+        case REG_NR32_ADDR:
+            return "NR32";
+        case REG_NR33_ADDR:
+            return "NR33";
+        case REG_NR34_ADDR:
+            return "NR34";
+        case REG_NR41_ADDR:
+            return "NR41";
+        case REG_NR42_ADDR:
+            return "NR42";
+        case REG_NR43_ADDR:
+            return "NR43";
+        case REG_NR44_ADDR:
+            return "NR44";
+        case REG_NR50_ADDR:
+            return "NR50";
+        case REG_NR51_ADDR:
+            return "NR51";
+        case REG_NR52_ADDR:
+            return "NR52";
+        case REG_LCDC_ADDR:
+            return "LCDC";
+        case REG_STAT_ADDR:
+            return "STAT";
+        case REG_SCY_ADDR:
+            return "SCY";
+        case REG_SCX_ADDR:
+            return "SCX";
+        case REG_LY_ADDR:
+            return "LY";
+        case REG_LYC_ADDR:
+            return "LYC";
+        case REG_DMA_ADDR:
+            return "DMA";
+        case REG_BGP_ADDR:
+            return "BGP";
+        case REG_OBP0_ADDR:
+            return "OBP0";
+        case REG_OBP1_ADDR:
+            return "OBP1";
+        case REG_WY_ADDR:
+            return "WY";
+        case REG_WX_ADDR:
+            return "WX";
+        case 0xFF50:
+            return "BOOT";
+        case REG_IE_ADDR:
+            return "IE";
+        default:
+            break;
+    }
+
+    if (addr >= REG_WAVE_RAM_START_ADDR && addr <= REG_WAVE_RAM_END_ADDR) return "WAVE" + std::to_string(addr - REG_WAVE_RAM_START_ADDR);
+
+    char name[8];
+    std::snprintf(name, sizeof(name), "%04X", addr);
+    return name;
+}
+
+MemoryStats::MemoryStats() { reset(); }
+
+void MemoryStats::add_region(const std::string& name, const uint16_t start, const uint16_t end) { regions_.push_back({name, start, end}); }
+
+void MemoryStats::reset() {
+    for (auto& counts : counts_) counts.assign(0x10000, 0);
+}
+
+MemoryAccessCounts MemoryStats::sum(const std::string& name, const uint16_t start, const uint16_t end) const {
+    MemoryAccessCounts result{name, start, end};
+    for (size_t access = 0; access < MEMORY_ACCESS_COUNT; access++) {
+        for (uint32_t addr = start; addr <= end; addr++) result.counts[access] += counts_[access][addr];
+    }
+    return result;
+}
+
+std::vector<MemoryAccessCounts> MemoryStats::get_pages() const {
+    std::vector<MemoryAccessCounts> pages;
+    pages.reserve(256);
+    for (uint32_t page = 0; page < 256; page++) {
+        char name[8];
+        std::snprintf(name, sizeof(name), "%02X", page);
+        pages.push_back(sum(name, page << 8, (page << 8) | 0xFF));
+    }
+    return pages;
+}
+
+std::vector<MemoryAccessCounts> MemoryStats::get_regions() const {
+    std::vector<MemoryAccessCounts> regions;
+    std::vector<bool> mapped(0x10000, false);
+    for (const Region& region : regions_) {
+        regions.push_back(sum(region.name, region.start, region.end));
+        for (uint32_t addr = region.start; addr <= region.end; addr++) mapped[addr] = true;
+    }
+
+    MemoryAccessCounts unmapped{"Unmapped", 0x0000, 0xFFFF};
+    for (uint32_t addr = 0; addr < 0x10000; addr++) {
+        if (mapped[addr]) continue;
+        for (size_t access = 0; access < MEMORY_ACCESS_COUNT; access++) unmapped.counts[access] += counts_[access][addr];
+    }
+    regions.push_back(unmapped);
+    return regions;
+}
+
+std::vector<MemoryAccessCounts> MemoryStats::get_io_registers() const {
+    std::vector<MemoryAccessCounts> registers;
+    for (uint32_t addr = IO_ADDR_START; addr <= REG_IE_ADDR; addr++) {
+        if (addr > IO_ADDR_END && addr != REG_IE_ADDR) continue;
+
+        MemoryAccessCounts reg = sum(io_register_name(addr), addr, addr);
+        if (std::ranges::any_of(reg.counts, [](const uint64_t count) { return count != 0; })) registers.push_back(std::move(reg));
+    }
+    return registers;
+}
+
+static void write_csv_rows(std::ofstream& file, const char* scope, const std::vector<MemoryAccessCounts>& rows) {
+    for (const MemoryAccessCounts& row : rows) {
+        char range[16];
+        std::snprintf(range, sizeof(range), "%04X,%04X", row.start, row.end);
+        file << scope << ',' << row.name << ',' << range;
+        for (const uint64_t count : row.counts) file << ',' << count;
+        file << '\n';
+    }
+}
+
+void MemoryStats::write_csv(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the memory statistics '" + path + "'");
+    }
+
+    file << "scope,name,start,end";
+    for (size_t access = 0; access < MEMORY_ACCESS_COUNT; access++) file << ',' << memory_access_name(static_cast<MemoryAccess>(access));
+    file << '\n';
+
+    write_csv_rows(file, "region", get_regions());
+    write_csv_rows(file, "page", get_pages());
+    write_csv_rows(file, "io", get_io_registers());
+}
+
+static void write_json_array(std::ofstream& file, const char* key, const std::vector<MemoryAccessCounts>& rows, const bool last) {
+    file << "  \"" << key << "\": [\n";
+    for (size_t i = 0; i < rows.size(); i++) {
+        file << "    {\"name\": \"" << rows[i].name << "\", \"start\": " << rows[i].start << ", \"end\": " << rows[i].end;
+        for (size_t access = 0; access < MEMORY_ACCESS_COUNT; access++) {
+            file << ", \"" << memory_access_name(static_cast<MemoryAccess>(access)) << "\": " << rows[i].counts[access];
+        }
+        file << (i + 1 < rows.size() ? "},\n" : "}\n");
+    }
+    file << (last ? "  ]\n" : "  ],\n");
+}
+
+void MemoryStats::write_json(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the memory statistics '" + path + "'");
+    }
+
+    file << "{\n";
+    write_json_array(file, "regions", get_regions(), false);
+    write_json_array(file, "pages", get_pages(), false);
+    write_json_array(file, "io", get_io_registers(), true);
+    file << "}\n";
+}
+
+void MemoryStats::write_heatmap(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the heatmap '" + path + "'");
+    }
+
+    // Each channel is scaled to the busiest address of its kind
+    constexpr std::array CHANNELS = {MemoryAccess::WRITE, MemoryAccess::READ, MemoryAccess::FETCH};
+    std::array<double, 3> scale{};
+    for (size_t channel = 0; channel < CHANNELS.size(); channel++) {
+        const auto& counts = counts_[static_cast<size_t>(CHANNELS[channel])];
+        const uint64_t max = *std::ranges::max_element(counts);
+        scale[channel] = max ? 255.0 / std::log1p(static_cast<double>(max)) : 0.0;
+    }
+
+    std::vector<uint8_t> pixels(0x10000 * 3);
+    for (uint32_t addr = 0; addr < 0x10000; addr++) {
+        for (size_t channel = 0; channel < CHANNELS.size(); channel++) {
+            const uint64_t count = counts_[static_cast<size_t>(CHANNELS[channel])][addr];
+            pixels[addr * 3 + channel] = static_cast<uint8_t>(std::log1p(static_cast<double>(count)) * scale[channel]);
+        }
+    }
+
+    file << "P6\n256 256\n255\n";
+    file.write(reinterpret_cast<const char*>(pixels.data()), static_cast<std::streamsize>(pixels.size()));
+}
+
+}  // namespace WindGB
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WindGB {
+
+enum class MemoryAccess : uint8_t {
+    READ = 0,     // CPU data read, Bus::read
+    WRITE,        // CPU write, Bus::write
+    FETCH,        // Opcode or operand read by the CPU, Bus::fetch
+    DIRECT_READ,  // Emulator side read bypassing the bus timing, Bus::direct_read
+    COUNT,
+};
+
+constexpr size_t MEMORY_ACCESS_COUNT = static_cast<size_t>(MemoryAccess::COUNT);
+
+[[nodiscard]] const char* memory_access_name(MemoryAccess access);
+
+struct MemoryAccessCounts {
+    std::string name;
+    uint16_t start;
+    uint16_t end;
+    std::array<uint64_t, MEMORY_ACCESS_COUNT> counts{};
+};
+
+// Bus accesses per address, only counted when the library is built with WINDGB_MEMORY_STATS
+class MemoryStats {
+   public:
+    MemoryStats();
+
+    void count(const MemoryAccess access, const uint16_t addr) { counts_[static_cast<size_t>(access)][addr]++; }
+    // Named area of the bus, as linked by Bus::link
+    void add_region(const std::string& name, uint16_t start, uint16_t end);
+    void reset();
+
+    [[nodiscard]] uint64_t get(MemoryAccess access, uint16_t addr) const { return counts_[static_cast<size_t>(access)][addr]; }
+    // The 256 pages of 256 bytes
+    [[nodiscard]] std::vector<MemoryAccessCounts> get_pages() const;
+    // Bus regions, plus the unmapped addresses
+    [[nodiscard]] std::vector<MemoryAccessCounts> get_regions() const;
+    // Accessed IO registers, including IE
+    [[nodiscard]] std::vector<MemoryAccessCounts> get_io_registers() const;
+
+    // "scope,name,start,end,read,write,fetch,direct_read" rows for the regions, pages and IO registers
+    void write_csv(const std::string& path) const;
+    void write_json(const std::string& path) const;
+    // 256x256 PPM, one pixel per address with a row per page: writes in red, reads in green and fetches in blue, log scaled
+    void write_heatmap(const std::string& path) const;
+
+   private:
+    struct Region {
+        std::string name;
+        uint16_t start;
+        uint16_t end;
+    };
+
+    std::array<std::vector<uint64_t>, MEMORY_ACCESS_COUNT> counts_;
+    std::vector<Region> regions_;
+
+    [[nodiscard]] MemoryAccessCounts sum(const std::string& name, uint16_t start, uint16_t end) const;
+};
+
+}  // namespace WindGB
@@ -0,0 +1,182 @@
+#include "movie.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "gameboy.hpp"
+#include "logger.hpp"
+
+namespace WindGB {
+
+static constexpr char MOVIE_MAGIC[4] = {'W', 'G', 'B', 'M'};
+static constexpr uint8_t MOVIE_VERSION = 1;
+
+static void put_u64(std::vector<uint8_t>& out, const uint64_t value) {
+    for (int i = 0; i < 8; i++) out.push_back((value >> (i * 8)) & 0xFF);
+}
+
+static void put_leb128(std::vector<uint8_t>& out, uint64_t value) {
+    do {
+        uint8_t byte = value & 0x7F;
+        value >>= 7;
+        if (value != 0) byte |= 0x80;
+        out.push_back(byte);
+    } while (value != 0);
+}
+
+static uint8_t read_u8(std::ifstream& file) {
+    const int byte = file.get();
+    if (byte == EOF) throw std::runtime_error("Truncated movie");
+    return static_cast<uint8_t>(byte);
+}
+
+static uint64_t read_u64(std::ifstream& file) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) value |= static_cast<uint64_t>(read_u8(file)) << (i * 8);
+    return value;
+}
+
+static uint64_t read_leb128(std::ifstream& file) {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        const uint8_t byte = read_u8(file);
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return value;
+    }
+    throw std::runtime_error("Corrupted movie");
+}
+
+MovieWriter::MovieWriter(const std::string& path, const uint64_t rom_hash, const BootMode start)
+    : file_(path, std::ios::binary | std::ios::out | std::ios::trunc) {
+    if (!file_) {
+        throw std::runtime_error("Unable to open the movie '" + path + "'");
+    }
+
+    buffer_.assign(MOVIE_MAGIC, MOVIE_MAGIC + 4);
+    buffer_.push_back(MOVIE_VERSION);
+    put_u64(buffer_, rom_hash);
+    buffer_.push_back(static_cast<uint8_t>(start));
+}
+
+MovieWriter::~MovieWriter() {
+    if (file_.is_open()) finish(last_tick_);
+}
+
+void MovieWriter::begin_record(const MovieRecord::Type type, const uint64_t tick) {
+    buffer_.push_back(static_cast<uint8_t>(type));
+    put_leb128(buffer_, tick - last_tick_);
+    last_tick_ = tick;
+}
+
+void MovieWriter::write_input(const uint64_t tick, const uint8_t buttons) {
+    begin_record(MovieRecord::Type::INPUT, tick);
+    buffer_.push_back(buttons);
+}
+
+void MovieWriter::write_checkpoint(const uint64_t tick, const uint64_t frame, const uint64_t frame_hash) {
+    begin_record(MovieRecord::Type::CHECKPOINT, tick);
+    put_leb128(buffer_, frame);
+    put_u64(buffer_, frame_hash);
+
+    // Checkpoints are regular, flush the records written so far with them
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+}
+
+void MovieWriter::finish(const uint64_t tick) {
+    begin_record(MovieRecord::Type::END, tick);
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+    file_.close();
+}
+
+MovieReader::MovieReader(const std::string& path) : file_(path, std::ios::binary | std::ios::in) {
+    if (!file_) {
+        throw std::runtime_error("Unable to open the movie '" + path + "'");
+    }
+
+    char magic[4];
+    file_.read(magic, 4);
+    if (!file_ || !std::equal(magic, magic + 4, MOVIE_MAGIC) || read_u8(file_) != MOVIE_VERSION) {
+        throw std::runtime_error("'" + path + "' is not a WindGB movie");
+    }
+    rom_hash_ = read_u64(file_);
+    start_ = static_cast<BootMode>(read_u8(file_));
+}
+
+bool MovieReader::next(MovieRecord& record) {
+    if (ended_) return false;
+
+    const int type = file_.get();
+    if (type == EOF) {  // Recording interrupted before the END record
+        ended_ = true;
+        return false;
+    }
+
+    record.type = static_cast<MovieRecord::Type>(type);
+    last_tick_ += read_leb128(file_);
+    record.tick = last_tick_;
+
+    switch (record.type) {
+        case MovieRecord::Type::INPUT:
+            record.buttons = read_u8(file_);
+            break;
+        case MovieRecord::Type::CHECKPOINT:
+            record.frame = read_leb128(file_);
+            record.frame_hash = read_u64(file_);
+            break;
+        case MovieRecord::Type::END:
+            ended_ = true;
+            break;
+        default:
+            throw std::runtime_error("Unknown movie record type");
+    }
+    return true;
+}
+
+MoviePlaybackResult play_movie(GameBoy& gameboy, MovieReader& movie) {
+    const GameBoy::Session session(gameboy);
+    if (gameboy.get_cartridge() && gameboy.get_cartridge()->get_rom_hash() != movie.get_rom_hash()) {
+        LOG_WARN("The movie was recorded with another ROM");
+    }
+
+    MoviePlaybackResult result;
+    MovieRecord record;
+    bool has_record = movie.next(record);
+    uint64_t last_frame = gameboy.get_ppu().get_frame_count();
+
+    while (has_record) {
+        // Apply every record due before the next instruction
+        while (has_record && gameboy.get_tick() >= record.tick) {
+            if (record.type == MovieRecord::Type::INPUT) {
+                gameboy.get_joypad().set_buttons(record.buttons);
+            } else if (record.type == MovieRecord::Type::CHECKPOINT) {
+                result.checkpoints++;
+                if (gameboy.get_ppu().get_frame_count() != record.frame || gameboy.get_frame_hash() != record.frame_hash) {
+                    result.mismatch_frame = record.frame;
+                    has_record = false;
+                    break;
+                }
+            } else {
+                has_record = false;
+                break;
+            }
+            has_record = movie.next(record);
+        }
+        if (!has_record) break;
+
+        gameboy.step();
+
+        // Frames are not consumed by a display, clear the flag like the frontend does
+        if (gameboy.get_ppu().get_frame_count() != last_frame) {
+            last_frame = gameboy.get_ppu().get_frame_count();
+            gameboy.get_ppu().mark_frame_consumed();
+        }
+    }
+
+    result.ticks = gameboy.get_tick();
+    result.frames = gameboy.get_ppu().get_frame_count();
+    return result;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "boot_rom.hpp"
+
+namespace WindGB {
+
+class GameBoy;
+
+// Movie layout (little endian):
+//  header: "WGBM", version (u8), ROM hash (u64), boot mode (u8)
+//  records: type (u8), ticks since the previous record (LEB128), then
+//           INPUT:      pressed buttons mask (u8), applied before the instruction starting at the tick
+//           CHECKPOINT: frame count (LEB128) and frame hash (u64) after the frame presented at the tick
+//           END:        nothing, the tick where the recording stopped
+struct MovieRecord {
+    enum class Type : uint8_t {
+        INPUT = 1,
+        CHECKPOINT = 2,
+        END = 3,
+    };
+
+    Type type;
+    uint64_t tick;
+    uint8_t buttons = 0;
+    uint64_t frame = 0;
+    uint64_t frame_hash = 0;
+};
+
+class MovieWriter {
+   public:
+    MovieWriter(const std::string& path, uint64_t rom_hash, BootMode start = BootMode::BOOT_ROM);
+    ~MovieWriter();
+
+    void write_input(uint64_t tick, uint8_t buttons);
+    void write_checkpoint(uint64_t tick, uint64_t frame, uint64_t frame_hash);
+    // Writes the END record and closes the file
+    void finish(uint64_t tick);
+
+   private:
+    std::ofstream file_;
+    std::vector<uint8_t> buffer_;
+    uint64_t last_tick_ = 0;
+
+    void begin_record(MovieRecord::Type type, uint64_t tick);
+};
+
+class MovieReader {
+   public:
+    explicit MovieReader(const std::string& path);
+
+    // Returns false after the END record or at the end of the file
+    bool next(MovieRecord& record);
+
+    [[nodiscard]] uint64_t get_rom_hash() const { return rom_hash_; }
+    [[nodiscard]] BootMode get_start() const { return start_; }
+
+   private:
+    std::ifstream file_;
+    uint64_t rom_hash_ = 0;
+    BootMode start_ = BootMode::BOOT_ROM;
+    uint64_t last_tick_ = 0;
+    bool ended_ = false;
+};
+
+struct MoviePlaybackResult {
+    uint64_t ticks = 0;
+    uint64_t frames = 0;
+    uint64_t checkpoints = 0;                // Checkpoints compared
+    std::optional<uint64_t> mismatch_frame;  // First frame whose hash differs from the recorded one
+};
+
+// Replays the movie on a GameBoy initialized with the boot mode of the movie, as fast as possible. Stops at the first checkpoint mismatch
+MoviePlaybackResult play_movie(GameBoy& gameboy, MovieReader& movie);
+
+}  // namespace WindGB
@@ -0,0 +1,70 @@
+#include "perf_counters.hpp"
+
+#include <cstdio>
+
+namespace WindGB {
+
+static constexpr std::array<const char*, 5> INTERRUPT_NAMES = {"VBlank", "STAT", "Timer", "Serial", "Joypad"};
+
+const char* bus_region_name(const BusRegion region) {
+    switch (region) {
+        case BusRegion::ROM:
+            return "ROM";
+        case BusRegion::VRAM:
+            return "VRAM";
+        case BusRegion::EXTERNAL_RAM:
+            return "External RAM";
+        case BusRegion::WRAM:
+            return "WRAM";
+        case BusRegion::OAM:
+            return "OAM";
+        case BusRegion::IO:
+            return "IO";
+        case BusRegion::HRAM:
+            return "HRAM";
+        default:
+            return "Unknown";
+    }
+}
+
+static double ratio(const uint64_t a, const uint64_t b) { return b ? static_cast<double>(a) / static_cast<double>(b) : 0.0; }
+
+static void append(std::string& out, const char* name, const uint64_t value, const char* detail = "") {
+    char line[96];
+    std::snprintf(line, sizeof(line), "%-22s %14llu%s\n", name, static_cast<unsigned long long>(value), detail);
+    out += line;
+}
+
+std::string format_counters(const PerfCounters& counters) {
+    char detail[48];
+    std::string out;
+
+    std::snprintf(detail, sizeof(detail), "  (%.2f M-cycles per instruction)", ratio(counters.m_cycles - counters.halt_cycles, counters.instructions));
+    append(out, "Instructions", counters.instructions, detail);
+    append(out, "M-cycles", counters.m_cycles);
+    std::snprintf(detail, sizeof(detail), "  (%.1f%%)", 100.0 * ratio(counters.halt_cycles, counters.m_cycles));
+    append(out, "HALT cycles", counters.halt_cycles, detail);
+
+    for (size_t i = 0; i < INTERRUPT_NAMES.size(); i++) {
+        const std::string name = std::string(INTERRUPT_NAMES[i]) + " interrupts";
+        append(out, name.c_str(), counters.interrupts[i]);
+    }
+
+    uint64_t bus_accesses = 0;
+    for (const uint64_t accesses : counters.bus_accesses) bus_accesses += accesses;
+    for (size_t i = 0; i < BUS_REGION_COUNT; i++) {
+        const std::string name = std::string(bus_region_name(static_cast<BusRegion>(i))) + " accesses";
+        std::snprintf(detail, sizeof(detail), "  (%.1f%%)", 100.0 * ratio(counters.bus_accesses[i], bus_accesses));
+        append(out, name.c_str(), counters.bus_accesses[i], detail);
+    }
+
+    append(out, "DMA transfers", counters.dma_transfers);
+    append(out, "Lines rendered", counters.lines_rendered);
+    std::snprintf(detail, sizeof(detail), "  (%.1f%%)", 100.0 * ratio(counters.lines_skipped, counters.lines_rendered + counters.lines_skipped));
+    append(out, "Lines skipped", counters.lines_skipped, detail);
+    append(out, "Frames", counters.frames);
+    append(out, "ROM bank switches", counters.rom_bank_switches, "  (0x4000-0x7FFF)");
+    return out;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace WindGB {
+
+enum class BusRegion : uint8_t {
+    ROM = 0,
+    VRAM,
+    EXTERNAL_RAM,
+    WRAM,  // Echo included
+    OAM,   // Prohibited area included
+    IO,    // IE included
+    HRAM,
+    COUNT,
+};
+
+constexpr size_t BUS_REGION_COUNT = static_cast<size_t>(BusRegion::COUNT);
+
+[[nodiscard]] const char* bus_region_name(BusRegion region);
+
+[[nodiscard]] constexpr BusRegion bus_region(const uint16_t addr) {
+    if (addr < 0x8000) return BusRegion::ROM;
+    if (addr < 0xA000) return BusRegion::VRAM;
+    if (addr < 0xC000) return BusRegion::EXTERNAL_RAM;
+    if (addr < 0xFE00) return BusRegion::WRAM;
+    if (addr < 0xFF00) return BusRegion::OAM;
+    if (addr < 0xFF80 || addr == 0xFFFF) return BusRegion::IO;
+    return BusRegion::HRAM;
+}
+
+// Event counts of one GameBoy since init, incremented with plain adds on the emulation thread.
+// Other threads read the copy published at every presented frame, see GameBoy::get_published_counters.
+struct PerfCounters {
+    uint64_t instructions = 0;
+    uint64_t m_cycles = 0;
+    uint64_t halt_cycles = 0;
+    std::array<uint64_t, 5> interrupts{};                   // VBlank, STAT, Timer, Serial, Joypad
+    std::array<uint64_t, BUS_REGION_COUNT> bus_accesses{};  // CPU reads, writes and fetches
+    uint64_t dma_transfers = 0;
+    uint64_t lines_rendered = 0;
+    uint64_t lines_skipped = 0;  // Unchanged since they were rendered in the same buffer
+    uint64_t frames = 0;
+    uint64_t rom_bank_switches = 0;  // Changes of the bank mapped at 0x4000-0x7FFF, the RAM bank and 0x0000-0x3FFF switches are not counted
+};
+
+// One counter per line, with the derived ratios
+[[nodiscard]] std::string format_counters(const PerfCounters& counters);
+
+}  // namespace WindGB
@@ -1,127 +1,253 @@
 #include "ppu.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
 
 #include "bus.hpp"
 #include "common.hpp"
-#include "io.hpp"
+#include "hash.hpp"
 #include "logger.hpp"
+#include "ram.hpp"
+#include "trace.hpp"
+#include "video_recorder.hpp"
 
 namespace WindGB {
 
-PPU::PPU(Bus& bus, IO& io)
-    : bus_(bus),
-      lcdc_(io.get_data()[REG_LCDC_ADDR - IO_ADDR_START]),
-      stat_(io.get_data()[REG_STAT_ADDR - IO_ADDR_START]),
-      scy_(io.get_data()[REG_SCY_ADDR - IO_ADDR_START]),
-      scx_(io.get_data()[REG_SCX_ADDR - IO_ADDR_START]),
-      ly_(io.get_data()[REG_LY_ADDR - IO_ADDR_START]),
-      lyc_(io.get_data()[REG_LYC_ADDR - IO_ADDR_START]),
-      dma_(io.get_data()[REG_DMA_ADDR - IO_ADDR_START]),
-      bgp_(io.get_data()[REG_BGP_ADDR - IO_ADDR_START]),
-      obp0_(io.get_data()[REG_OBP0_ADDR - IO_ADDR_START]),
-      obp1_(io.get_data()[REG_OBP1_ADDR - IO_ADDR_START]),
-      wy_(io.get_data()[REG_WY_ADDR - IO_ADDR_START]),
-      wx_(io.get_data()[REG_WX_ADDR - IO_ADDR_START]),
-      if_(io.get_data()[REG_IF_ADDR - IO_ADDR_START]),
-      display_buffer_(&buffer_a_),
-      render_buffer_(&buffer_b_) {}
+size_t Screen::copy_lines(const Screen& other, const Lines::Bitmap& pages) {
+    if (pages.none()) return 0;
+    size_t copied = 0;
+    for (size_t page = 0; page < pages.size(); page++) {
+        if (!pages[page]) continue;
+        const size_t buffer = page / SCREEN_HEIGHT;
+        const size_t offset = (page % SCREEN_HEIGHT) * SCREEN_WIDTH;
+        std::copy_n(other.framebuffers[buffer].begin() + offset, SCREEN_WIDTH, framebuffers[buffer].begin() + offset);
+        std::copy_n(other.shades[buffer].begin() + offset, SCREEN_WIDTH, shades[buffer].begin() + offset);
+        lines.mark(page);
+        copied += SCREEN_WIDTH * (sizeof(uint32_t) + sizeof(uint8_t));
+    }
+    return copied;
+}
+
+PPU::PPU(Bus& bus, MachineState& state, VRAM& vram, OAM& oam, Screen& screen) {
+    link(bus, state, vram, oam, screen);
+    vram_observer_ = vram_->add_observer();
+    oam_observer_ = oam_->add_observer();
+}
+
+void PPU::link(Bus& bus, MachineState& state, VRAM& vram, OAM& oam, Screen& screen) {
+    bus_ = &bus;
+    vram_ = &vram;
+    oam_ = &oam;
+    screen_ = &screen;
+    state_ = &state;
+}
 
 void PPU::init() {
     mode_ = Mode::OAMSCAN;
     gfx_counter_ = 0;
     window_line_counter_ = 0;
     frame_ready_ = false;
+    mode3_length_ = 172;
+    state_->ppu_last_sync = state_->tick;
+
+    screen_->framebuffers = {};
+    screen_->lines.mark_all();
+    line_fingerprints_ = {};
+    line_hashes_ = {};
+    presented_.store({0, static_cast<uint64_t>(render_index_ ^ 1)});
+    frame_count_ = 0;
 
-    buffer_a_ = {0};
-    buffer_b_ = {0};
+    reschedule();
 
     LOG_INFO("PPU initialized");
 }
 
-void PPU::tick() {
-    if (!GET_BIT(lcdc_, 7)) {  // PPU/LCD enabled ?
-        gfx_counter_ = 0;
-        ly_ = 0;
-        window_line_counter_ = 0;
-        mode_ = Mode::HBLANK;
-
-        if (!frame_blank_filled_) {
-            std::ranges::fill(*render_buffer_, default_palette_[0]);
-            present_frame();
-            frame_ready_ = true;
-            frame_blank_filled_ = true;
-        }
+void PPU::sync() {
+    const uint64_t now = state_->tick;
+    const uint64_t dots = (now - state_->ppu_last_sync) * 4;  // 4 dots per M-cycle
+    state_->ppu_last_sync = now;
+
+    if (dots > 0 && run(dots)) {
+        reschedule();
+    }
+}
+
+uint64_t PPU::hash_state() const {
+    // The mode 3 length is left out, it is fixed for the scanline engine and varies with the FIFO engine without the
+    // line timing differing
+    const uint64_t timing = gfx_counter_ | (static_cast<uint64_t>(mode_) << 48);
+    const uint64_t flags = window_line_counter_ | (frame_blank_filled_ << 8);
+    return hash_combine(hash_combine(hash_combine(timing, flags), state_->ppu_last_sync), get_frame_hash());
+}
+
+void PPU::reschedule() {
+    if (!GET_BIT(lcdc(), 7)) {  // The blank frame is presented on the next dot
+        state_->ppu_next_event = frame_blank_filled_ ? NEVER : state_->ppu_last_sync + 1;
         return;
     }
 
-    gfx_counter_++;
-    frame_blank_filled_ = false;
+    // Dots left before the next LY increment
+    uint64_t dots;
+    switch (mode_) {
+        case Mode::HBLANK:
+            dots = mode_length() - gfx_counter_;
+            break;
+        case Mode::VBLANK:
+            dots = 456 - gfx_counter_;
+            break;
+        case Mode::OAMSCAN:
+            dots = 456 - gfx_counter_;
+            break;
+        default:  // DRAWING, the line length does not depend on the mode 3 length
+            dots = 456 - 80 - gfx_counter_;
+            break;
+    }
+
+    // Walk the following LY increments until one of them raises an interrupt, every line lasts 456 dots
+    uint8_t line_ly = ly();
+    for (int line = 0; line < 154; line++) {
+        const uint8_t next_ly = (line_ly + 1) % 154;
+        if (next_ly == 144 || (GET_BIT(stat(), 6) && next_ly == lyc())) {
+            state_->ppu_next_event = state_->ppu_last_sync + (dots + 3) / 4;
+            return;
+        }
+        line_ly = next_ly >= 154 - 1 ? 0 : next_ly;
+        dots += 456;
+    }
+    state_->ppu_next_event = NEVER;
+}
+
+bool PPU::run(uint64_t dots) {
+    bool line_changed = false;
 
-    // PPU state machine
-    if (mode_ == Mode::HBLANK) {
-        if (gfx_counter_ >= 204) {
+    while (dots > 0) {
+        if (!GET_BIT(lcdc(), 7)) {  // PPU/LCD enabled ?
             gfx_counter_ = 0;
+            ly() = 0;
+            window_line_counter_ = 0;
+            mode_ = Mode::HBLANK;
+            mode3_length_ = 172;
+
+            if (!frame_blank_filled_) {
+                std::ranges::fill(screen_->framebuffers[render_index_], default_palette_[0]);
+                for (uint8_t line = 0; line < SCREEN_HEIGHT; line++) screen_->lines.mark(render_index_ * SCREEN_HEIGHT + line);
+                line_fingerprints_[render_buffer_index()].fill(0);
+                std::fill_n(render_shades(), SCREEN_WIDTH * SCREEN_HEIGHT, 0);
+                line_hashes_[render_buffer_index()].fill(hash_bytes(render_shades(), SCREEN_WIDTH));
+                present_frame();
+                frame_ready_ = true;
+                frame_blank_filled_ = true;
+                line_changed = true;
+            }
+            return line_changed;
+        }
+
+        frame_blank_filled_ = false;
+
+        if (mode_ == Mode::DRAWING && line_engine_ == Engine::FIFO) {  // Variable length mode 3, stepped dot by dot
+            while (dots > 0 && mode_ == Mode::DRAWING) {
+                gfx_counter_++;
+                dots--;
+                if (fifo_step()) {
+                    line_hashes_[render_buffer_index()][ly()] = hash_bytes(render_shades() + ly() * SCREEN_WIDTH, SCREEN_WIDTH);
+                    mode3_length_ = gfx_counter_;
+                    gfx_counter_ = 0;
+                    mode_ = Mode::HBLANK;
+                }
+            }
+            continue;
+        }
+
+        // Skip straight to the end of the current mode when possible
+        const uint32_t remaining = mode_length() - gfx_counter_;
+        if (dots < remaining) {
+            gfx_counter_ += dots;
+            break;
+        }
+        dots -= remaining;
+        gfx_counter_ = 0;
+
+        // PPU state machine
+        if (mode_ == Mode::HBLANK) {
             inc_ly();
-            if (ly_ == 144) {  // All 144 scanlines have been drawn, switch to 10 VBLANK scanlines
+            line_changed = true;
+            if (ly() == 144) {  // All 144 scanlines have been drawn, switch to 10 VBLANK scanlines
                 window_line_counter_ = 0;
                 mode_ = Mode::VBLANK;
                 present_frame();
                 frame_ready_ = true;
-                if_ |= (1 << 0);
+                interrupt_flags() |= (1 << 0);
             } else {  // Start to draw the next scanline
                 mode_ = Mode::OAMSCAN;
                 inc_window_line_counter();
             }
-        }
-    } else if (mode_ == Mode::VBLANK) {
-        if (gfx_counter_ >= 456) {
-            gfx_counter_ = 0;
+        } else if (mode_ == Mode::VBLANK) {
             inc_ly();
-            if (ly_ >= 154 - 1) {  // Last scanline
-                ly_ = 0;
+            line_changed = true;
+            if (ly() >= 154 - 1) {  // Last scanline
+                ly() = 0;
                 mode_ = Mode::OAMSCAN;
             }
-        }
-    } else if (mode_ == Mode::OAMSCAN) {
-        if (gfx_counter_ >= 80) {
-            gfx_counter_ = 0;
+        } else if (mode_ == Mode::OAMSCAN) {
             mode_ = Mode::DRAWING;
+            line_engine_ = engine_;
             evaluate_sprites();
-        }
-    } else {  // DRAWING
-        if (gfx_counter_ >= 172) {
-            gfx_counter_ = 0;
+            if (line_engine_ == Engine::FIFO) {
+                line_fingerprints_[render_buffer_index()][ly()] = 0;
+                mark_line_drawn();
+                fifo_start_line();
+            }
+        } else {  // DRAWING
             mode_ = Mode::HBLANK;
+            mode3_length_ = 172;
             render_scanline();
         }
     }
+
+    return line_changed;
+}
+
+uint32_t PPU::mode_length() const {
+    switch (mode_) {
+        case Mode::HBLANK:
+            return 456 - 80 - mode3_length_;
+        case Mode::VBLANK:
+            return 456;
+        case Mode::OAMSCAN:
+            return 80;
+        default:  // DRAWING, only used by the scanline engine
+            return 172;
+    }
 }
 
 void PPU::inc_ly() {
-    ly_ = (ly_ + 1) % 154;
-    if (ly_ == lyc_) {
-        stat_ |= (1 << 2);
-        if (GET_BIT(stat_, 6)) {
-            if_ |= (1 << 1);
+    ly() = (ly() + 1) % 154;
+    if (ly() == lyc()) {
+        stat() |= (1 << 2);
+        if (GET_BIT(stat(), 6)) {
+            interrupt_flags() |= (1 << 1);
         }
     } else {
-        stat_ &= ~(1 << 2);
+        stat() &= ~(1 << 2);
     }
 }
 void PPU::inc_window_line_counter() {
-    if (GET_BIT(lcdc_, 5) && ly_ > wy_ && wx_ <= 166) {
+    if (GET_BIT(lcdc(), 5) && ly() > wy() && wx() <= 166) {
         window_line_counter_++;
     }
 }
 
-void PPU::set_pixel(const uint8_t x, const uint8_t y, const uint32_t color) { (*render_buffer_)[y * SCREEN_WIDTH + x] = color; }
+void PPU::set_pixel(const uint8_t x, const uint8_t y, const uint8_t shade) {
+    screen_->framebuffers[render_index_][y * SCREEN_WIDTH + x] = default_palette_[shade];
+    render_shades()[y * SCREEN_WIDTH + x] = shade;
+}
 
 uint8_t PPU::get_tile_pixel(const uint16_t tile_data_addr, const uint8_t pixel_x, const uint8_t pixel_y) const {
     const uint16_t line_addr = tile_data_addr + (pixel_y * 2);
 
-    const uint8_t low_byte = bus_.direct_read(line_addr);
-    const uint8_t high_byte = bus_.direct_read(line_addr + 1);
+    const uint8_t low_byte = vram_->get_data()[line_addr - VRAM_ADDR_START];
+    const uint8_t high_byte = vram_->get_data()[line_addr + 1 - VRAM_ADDR_START];
 
     const uint8_t bit_pos = 7 - pixel_x;
 
@@ -131,127 +257,177 @@ uint8_t PPU::get_tile_pixel(const uint16_t tile_data_addr, const uint8_t pixel_x
     return (high_bit << 1) | low_bit;
 }
 
-void PPU::evaluate_sprites() {
-    scanline_sprites_.clear();  // Remove all sprites for the new scanline
-
-    const uint16_t obj_size = GET_BIT(lcdc_, 2) ? 16 : 8;
-    uint32_t sprite_count = 0;
-
-    for (uint16_t i = 0; i < 40; i++) {                    // OAM store up to 40 sprites
-        const uint16_t oam_addr = OAM_ADDR_START + i * 4;  // OAM sprite takes 4 bytes in memory
-
-        // Recover sprite data
-        const uint8_t y = bus_.direct_read(oam_addr);
-        const uint8_t x = bus_.direct_read(oam_addr + 1);
-        const uint8_t tile = bus_.direct_read(oam_addr + 2);
-        const uint8_t attr = bus_.direct_read(oam_addr + 3);
-
-        // Check if the scanline intercept the sprite position
-        if (ly_ >= y - 16 && ly_ < y - 16 + obj_size) {
-            Sprite sprite(x, y, tile);
-            sprite.bg_priority = GET_BIT(attr, 7);
-            sprite.y_flip = GET_BIT(attr, 6);
-            sprite.x_flip = GET_BIT(attr, 5);
-            sprite.palette = GET_BIT(attr, 4);
-            sprite.oam_addr = oam_addr;
+void PPU::build_sprite_index() {
+    const uint8_t* oam = oam_->get_data();
+    const uint8_t obj_size = GET_BIT(lcdc(), 2) ? 16 : 8;
+
+    caches_->line_sprite_count.fill(0);
+    for (uint8_t i = 0; i < caches_->oam_sprites.size(); i++) {  // OAM store up to 40 sprites
+        const uint8_t* entry = oam + i * 4;               // OAM sprite takes 4 bytes in memory
+
+        Sprite& sprite = caches_->oam_sprites[i];
+        sprite = Sprite(entry[1], entry[0], entry[2]);
+        sprite.bg_priority = GET_BIT(entry[3], 7);
+        sprite.y_flip = GET_BIT(entry[3], 6);
+        sprite.x_flip = GET_BIT(entry[3], 5);
+        sprite.palette = GET_BIT(entry[3], 4);
+        sprite.oam_index = i;
+        sprite.oam_addr = OAM_ADDR_START + i * 4;
+
+        // Scanlines intercepting the sprite, the first 10 sprites in OAM order are kept on each line
+        const int top = sprite.y - 16;
+        for (int line = std::max(top, 0); line < std::min(top + obj_size, static_cast<int>(SCREEN_HEIGHT)); line++) {
+            auto& sprites = caches_->line_sprites[line];
+            uint8_t& count = caches_->line_sprite_count[line];
+            if (count == MAX_LINE_SPRITES) continue;
+
+            // Keep drawing order: the sprite drawn last (lowest X, then lowest OAM index) is on top
+            uint8_t pos = count++;
+            while (pos > 0 && caches_->oam_sprites[sprites[pos - 1]].x <= sprite.x) {
+                sprites[pos] = sprites[pos - 1];
+                pos--;
+            }
+            sprites[pos] = i;
+        }
+    }
 
-            scanline_sprites_.push_back(sprite);
-            sprite_count++;
+    caches_->sprite_index_obj_size = obj_size;
+    oam_->clear_dirty(oam_observer_);
+}
 
-            if (sprite_count == 10) break;  // Max 10 sprites per scanline
-        }
+void PPU::evaluate_sprites() {
+    if (oam_->get_dirty_entries(oam_observer_).any() || caches_->sprite_index_obj_size != (GET_BIT(lcdc(), 2) ? 16 : 8)) {
+        build_sprite_index();
     }
 
-    // Sort sprites by X growing
-    std::sort(scanline_sprites_.begin(), scanline_sprites_.end(), [](const Sprite& a, const Sprite& b) { return a.x >= b.x; });
+    scanline_sprite_count_ = caches_->line_sprite_count[ly()];
+    for (uint8_t i = 0; i < scanline_sprite_count_; i++) {
+        scanline_sprites_[i] = caches_->oam_sprites[caches_->line_sprites[ly()][i]];
+    }
 }
 
-void PPU::fill_line(const uint32_t color) {
-    if (ly_ < SCREEN_HEIGHT) {
+void PPU::fill_line(const uint8_t shade) {
+    if (ly() < SCREEN_HEIGHT) {
+        std::fill_n(pixel_ids_.begin(), SCREEN_WIDTH, 0);
         for (int x = 0; x < SCREEN_WIDTH; x++) {
-            set_pixel(x, ly_, color);
+            set_pixel(x, ly(), shade);
         }
     }
 }
 
-void PPU::render_bg_line() {
-    const uint8_t bg_y = (ly_ + scy_) & 0xFF;
-    const uint8_t tile_row = bg_y / 8;
-    const uint8_t pixel_row = bg_y % 8;
-
-    const uint16_t tile_map_base = (GET_BIT(lcdc_, 3)) ? TILE_MAP_1 : TILE_MAP_0;
-
-    const bool signed_addressing = !GET_BIT(lcdc_, 4);
-
-    for (int x = 0; x < SCREEN_WIDTH; x++) {
-        const uint8_t bg_x = (x + scx_) & 0xFF;
-        const uint8_t tile_col = bg_x / 8;
-        const uint8_t pixel_col = bg_x % 8;
-        const uint16_t tile_map_addr = tile_map_base + (tile_row * 32) + tile_col;
-        const uint8_t tile_id = bus_.direct_read(tile_map_addr);
-
-        uint16_t tile_data_addr;
-        if (signed_addressing) {
-            const auto signed_id = static_cast<int8_t>(tile_id);
-            tile_data_addr = 0x9000 + (signed_id * 16);
-        } else {
-            tile_data_addr = TILE_DATA_0 + (tile_id * 16);
+uint16_t PPU::tile_index(const uint8_t tile_id, const bool signed_addressing) {
+    if (signed_addressing) {  // 0x9000 based, tiles 256-383 then 128-255
+        return tile_id < 0x80 ? 256 + tile_id : tile_id;
+    }
+    return tile_id;
+}
+
+void PPU::collect_vram_changes() {
+    const auto& dirty_tiles = vram_->get_dirty_tiles(vram_observer_);
+    const auto& dirty_rows = vram_->get_dirty_map_rows(vram_observer_);
+    if (dirty_tiles.none() && dirty_rows.none()) return;
+
+    const uint8_t* map_data = vram_->get_data() + (TILE_MAP_0 - VRAM_ADDR_START);
+    for (uint8_t map = 0; map < 2; map++) {
+        for (uint16_t cell = 0; cell < 32 * 32; cell++) {
+            const uint8_t tile_id = map_data[map * 0x400 + cell];
+            const bool row_dirty = dirty_rows[map * 32 + cell / 32];
+            for (uint8_t addressing = 0; addressing < 2; addressing++) {
+                if (row_dirty || dirty_tiles[tile_index(tile_id, addressing)]) {
+                    caches_->map_caches[map * 2 + addressing].stale_cells.set(cell);
+                }
+            }
         }
+    }
 
-        const uint8_t color_id = get_tile_pixel(tile_data_addr, pixel_col, pixel_row);
-        pixel_ids_[ly_ * SCREEN_WIDTH + x] = color_id;
+    for (uint16_t tile = 0; tile < VRAM::TILE_COUNT; tile++) {
+        if (dirty_tiles[tile]) caches_->tile_versions[tile]++;
+    }
 
-        const uint8_t palette_color = (bgp_ >> (color_id * 2)) & 0x03;
-        const uint32_t final_color = default_palette_[palette_color];
+    vram_->clear_dirty(vram_observer_);
+}
 
-        set_pixel(x, ly_, final_color);
+void PPU::refresh_map_cache_row(const bool map_1, const bool signed_addressing, const uint8_t tile_row) {
+    collect_vram_changes();
+
+    auto& cache = caches_->map_caches[map_1 * 2 + signed_addressing];
+    const uint8_t* map_data = vram_->get_data() + ((map_1 ? TILE_MAP_1 : TILE_MAP_0) - VRAM_ADDR_START) + tile_row * 32;
+    const uint8_t* tile_data = vram_->get_data();
+
+    // Redraw the stale tiles of this row
+    for (uint8_t tile_col = 0; tile_col < 32; tile_col++) {
+        const uint16_t cell = tile_row * 32 + tile_col;
+        if (!cache.stale_cells[cell]) continue;
+        cache.stale_cells.reset(cell);
+        cache.row_versions[tile_row]++;
+
+        const uint8_t* tile = tile_data + tile_index(map_data[tile_col], signed_addressing) * 16;
+        for (uint8_t pixel_y = 0; pixel_y < 8; pixel_y++) {
+            uint8_t* out = cache.pixels.data() + (tile_row * 8 + pixel_y) * 256 + tile_col * 8;
+            const uint8_t low_byte = tile[pixel_y * 2];
+            const uint8_t high_byte = tile[pixel_y * 2 + 1];
+            for (uint8_t pixel_x = 0; pixel_x < 8; pixel_x++) {
+                const uint8_t bit_pos = 7 - pixel_x;
+                out[pixel_x] = (((high_byte >> bit_pos) & 1) << 1) | ((low_byte >> bit_pos) & 1);
+            }
+        }
     }
 }
 
-void PPU::render_window_line() {
-    if (wy_ > ly_) return;
-    if (wx_ >= 167) return;
+const uint8_t* PPU::get_map_cache_line(const bool map_1, const bool signed_addressing, const uint8_t y) {
+    refresh_map_cache_row(map_1, signed_addressing, y / 8);
+    return caches_->map_caches[map_1 * 2 + signed_addressing].pixels.data() + y * 256;
+}
 
-    const uint8_t tile_row = window_line_counter_ / 8;
-    const uint8_t pixel_row = window_line_counter_ % 8;
+uint32_t PPU::get_map_cache_row_version(const bool map_1, const bool signed_addressing, const uint8_t y) {
+    refresh_map_cache_row(map_1, signed_addressing, y / 8);
+    return caches_->map_caches[map_1 * 2 + signed_addressing].row_versions[y / 8];
+}
 
-    const uint16_t tile_map_base = GET_BIT(lcdc_, 6) ? TILE_MAP_1 : TILE_MAP_0;
+void PPU::apply_bg_palette(const int start_x) {
+    uint8_t shades[4];
+    for (uint8_t color_id = 0; color_id < 4; color_id++) {
+        shades[color_id] = (bgp() >> (color_id * 2)) & 0x03;
+    }
 
-    const bool signed_addressing = !GET_BIT(lcdc_, 4);
+    const uint8_t* ids = pixel_ids_.data();
+    for (int x = start_x; x < SCREEN_WIDTH; x++) {
+        set_pixel(x, ly(), shades[ids[x]]);
+    }
+}
 
-    const int window_start_x = wx_ - 7;
+void PPU::render_bg_line() {
+    const uint8_t bg_y = (ly() + scy()) & 0xFF;
+    const uint8_t* line = get_map_cache_line(GET_BIT(lcdc(), 3), !GET_BIT(lcdc(), 4), bg_y);
 
-    for (int screen_x = std::max(0, window_start_x); screen_x < SCREEN_WIDTH; screen_x++) {
-        const uint8_t window_x = screen_x - window_start_x;
-        const uint8_t tile_col = window_x / 8;
-        const uint8_t pixel_col = window_x % 8;
+    // Wrapped copy of the 160 visible pixels
+    uint8_t* ids = pixel_ids_.data();
+    const int first_part = std::min<int>(SCREEN_WIDTH, 256 - scx());
+    std::memcpy(ids, line + scx(), first_part);
+    std::memcpy(ids + first_part, line, SCREEN_WIDTH - first_part);
 
-        const uint16_t tile_map_addr = tile_map_base + (tile_row * 32) + tile_col;
-        const uint8_t tile_id = bus_.direct_read(tile_map_addr);
+    apply_bg_palette(0);
+}
 
-        uint16_t tile_data_addr;
-        if (signed_addressing) {
-            const auto signed_id = static_cast<int8_t>(tile_id);
-            tile_data_addr = 0x9000 + (signed_id * 16);
-        } else {
-            tile_data_addr = TILE_DATA_0 + (tile_id * 16);
-        }
+void PPU::render_window_line() {
+    if (wy() > ly()) return;
+    if (wx() >= 167) return;
 
-        const uint8_t color_id = get_tile_pixel(tile_data_addr, pixel_col, pixel_row);
-        pixel_ids_[ly_ * SCREEN_WIDTH + screen_x] = color_id;
+    const uint8_t* line = get_map_cache_line(GET_BIT(lcdc(), 6), !GET_BIT(lcdc(), 4), window_line_counter_);
 
-        const uint8_t palette_color = (bgp_ >> (color_id * 2)) & 0x03;
-        const uint32_t final_color = default_palette_[palette_color];
+    const int window_start_x = wx() - 7;
+    const int start_x = std::max(0, window_start_x);
+    std::memcpy(pixel_ids_.data() + start_x, line + (start_x - window_start_x), SCREEN_WIDTH - start_x);
 
-        set_pixel(screen_x, ly_, final_color);
-    }
+    apply_bg_palette(start_x);
 }
 
 void PPU::render_obj_line() {
-    const uint16_t obj_size = GET_BIT(lcdc_, 2) ? 16 : 8;
+    const uint16_t obj_size = GET_BIT(lcdc(), 2) ? 16 : 8;
 
-    for (const auto& sprite : scanline_sprites_) {
-        uint8_t sprite_y = ly_ - (sprite.y - 16);  // The relative position of the scanline in the sprite
+    for (uint8_t i = 0; i < scanline_sprite_count_; i++) {
+        const Sprite& sprite = scanline_sprites_[i];
+        uint8_t sprite_y = ly() - (sprite.y - 16);  // The relative position of the scanline in the sprite
         if (sprite.y_flip) sprite_y = obj_size - 1 - sprite_y;
 
         if (sprite_y >= obj_size) continue;
@@ -272,38 +448,94 @@ void PPU::render_obj_line() {
             if (lcd_x >= 160 || lcd_x < 0) continue;
 
             // Check the pixel color of the background if bg_priority
-            uint8_t bg_pixel_id = pixel_ids_.at(ly_ * SCREEN_WIDTH + lcd_x);
+            uint8_t bg_pixel_id = pixel_ids_.at(lcd_x);
             if (sprite.bg_priority && bg_pixel_id != 0) continue;
 
             // Populate the framebuffer
-            const uint8_t palette = sprite.palette ? obp1_ : obp0_;
-            const uint8_t color_id = (palette >> (pixel * 2)) & 0x03;
+            const uint8_t palette = sprite.palette ? obp1() : obp0();
+            const uint8_t shade = (palette >> (pixel * 2)) & 0x03;
+
+            set_pixel(lcd_x, ly(), shade);
+        }
+    }
+}
 
-            const auto& color = default_palette_[color_id];
+uint64_t PPU::line_fingerprint() {
+    collect_vram_changes();  // The sprite tile versions are read even when no map cache row is refreshed
+
+    uint64_t fingerprint = hash_combine(0, ly() | (lcdc() << 8) | (scx() << 16) | (scy() << 24) | (static_cast<uint64_t>(bgp()) << 32) |
+                                               (static_cast<uint64_t>(obp0()) << 40) | (static_cast<uint64_t>(obp1()) << 48));
+
+    if (GET_BIT(lcdc(), 0)) {  // BG & Window enable
+        const uint8_t bg_y = (ly() + scy()) & 0xFF;
+        fingerprint = hash_combine(fingerprint, get_map_cache_row_version(GET_BIT(lcdc(), 3), !GET_BIT(lcdc(), 4), bg_y));
+        if (GET_BIT(lcdc(), 5) && wy() <= ly() && wx() < 167) {  // Window visible on this line
+            const uint32_t version = get_map_cache_row_version(GET_BIT(lcdc(), 6), !GET_BIT(lcdc(), 4), window_line_counter_);
+            fingerprint = hash_combine(fingerprint, wx() | (window_line_counter_ << 8) | (static_cast<uint64_t>(version) << 32));
+        }
+    }
 
-            set_pixel(lcd_x, ly_, color);
+    if (GET_BIT(lcdc(), 1)) {  // OBJ enable
+        const auto& tile_versions = caches_->tile_versions;
+        for (uint8_t i = 0; i < scanline_sprite_count_; i++) {
+            const Sprite& sprite = scanline_sprites_[i];
+            const uint8_t attr = (sprite.bg_priority << 3) | (sprite.y_flip << 2) | (sprite.x_flip << 1) | sprite.palette;
+            const uint64_t versions = tile_versions[sprite.tile_index & 0xFE] | (static_cast<uint64_t>(tile_versions[sprite.tile_index | 0x01]) << 32);
+            fingerprint = hash_combine(fingerprint, sprite.x | (sprite.y << 8) | (sprite.tile_index << 16) | (attr << 24));
+            fingerprint = hash_combine(fingerprint, versions);
         }
     }
+
+    return fingerprint | 1;  // 0 marks a line that has to be redrawn
 }
 
 void PPU::render_scanline() {
-    if (GET_BIT(lcdc_, 0)) {  // BG & Window enable
+    TRACE_SCOPE("Render scanline");
+
+    // Keep the line of the buffer as it is when it was rendered from the same inputs two frames ago
+    const uint64_t fingerprint = line_fingerprint();
+    uint64_t& last_fingerprint = line_fingerprints_[render_buffer_index()][ly()];
+    if (fingerprint == last_fingerprint) {
+        bus_->get_counters().lines_skipped++;
+        return;
+    }
+    last_fingerprint = fingerprint;
+    mark_line_drawn();
+    bus_->get_counters().lines_rendered++;
+
+    if (GET_BIT(lcdc(), 0)) {  // BG & Window enable
         render_bg_line();
-        if (GET_BIT(lcdc_, 5)) {  // Window enable
+        if (GET_BIT(lcdc(), 5)) {  // Window enable
             render_window_line();
         }
     } else {
-        fill_line(default_palette_[0]);
+        fill_line(0);
     }
 
-    if (GET_BIT(lcdc_, 1)) {  // OBJ enable
+    if (GET_BIT(lcdc(), 1)) {  // OBJ enable
         render_obj_line();
     }
+
+    line_hashes_[render_buffer_index()][ly()] = hash_bytes(render_shades() + ly() * SCREEN_WIDTH, SCREEN_WIDTH);
 }
 
 void PPU::present_frame() {
-    auto* old_display = display_buffer_.exchange(render_buffer_);
-    render_buffer_ = old_display;
+    TRACE_SCOPE("Present frame");
+
+    uint64_t frame_hash = 0;
+    for (const uint64_t line_hash : line_hashes_[render_buffer_index()]) {
+        frame_hash = hash_combine(frame_hash, line_hash);
+    }
+    frame_count_++;
+    bus_->get_counters().frames++;
+    bus_->publish_counters();
+
+    if (recorder_) {
+        recorder_->push_frame(render_shades());
+    }
+
+    presented_.store({frame_hash, render_index_});
+    render_index_ ^= 1;
 }
 
 }  // namespace WindGB
\ No newline at end of file
@@ -1,14 +1,23 @@
 #pragma once
 
 #include <array>
-#include <atomic>
+#include <bitset>
 #include <cstdint>
-#include <vector>
+#include <memory>
+
+#include "common.hpp"
+#include "dirty.hpp"
+#include "machine_state.hpp"
+#include "seqlock.hpp"
 
 namespace WindGB {
 
+using Palette = std::array<uint32_t, 4>;  // RGBA color of each shade
+
 class Bus;
-class IO;
+class OAM;
+class VRAM;
+class VideoRecorder;
 
 struct Sprite {
     uint8_t x;
@@ -23,19 +32,95 @@ struct Sprite {
     uint16_t oam_index = 0x0000;
     uint16_t oam_addr = 0x0000;
 
+    Sprite() : Sprite(0, 0, 0) {}
     Sprite(const uint8_t x, const uint8_t y, const uint8_t tile_index) : x(x), y(y), tile_index(tile_index) {}
 };
 
+// Frame buffers the PPU draws into, owned by the machine so that a snapshot only copies the lines drawn since the last one
+struct Screen {
+    using Lines = PageTracker<2 * SCREEN_HEIGHT>;  // Line y of buffer b is page b * SCREEN_HEIGHT + y
+
+    std::array<std::array<uint32_t, SCREEN_WIDTH * SCREEN_HEIGHT>, 2> framebuffers{};
+    std::array<std::array<uint8_t, SCREEN_WIDTH * SCREEN_HEIGHT>, 2> shades{};  // Shade of the same pixels
+    Lines lines;
+
+    // Copies the given lines of other, returns the bytes copied
+    size_t copy_lines(const Screen& other, const Lines::Bitmap& pages);
+};
+
+// Hash of the last presented frame and the screen buffer holding it, published together to the other threads
+struct PresentedFrame {
+    uint64_t hash = 0;
+    uint64_t buffer = 0;
+};
+
+// State of the pixel FIFO engine, only meaningful while a line is drawn with PPU::Engine::FIFO
+struct PixelFifo {
+    struct ObjPixel {
+        uint8_t color;
+        bool palette;
+        bool bg_priority;
+    };
+
+    std::array<uint8_t, 16> bg{};
+    uint8_t bg_head = 0;
+    uint8_t bg_size = 0;
+    std::array<ObjPixel, 8> obj{};
+    uint8_t obj_head = 0;
+    uint8_t obj_size = 0;
+
+    // Background/window fetcher
+    uint8_t fetch_dots = 0;  // Dots spent on the current tile fetch, the tile is ready to be pushed after 6 dots
+    uint8_t fetch_x = 0;     // Tile column counter
+    uint8_t tile_id = 0;
+    uint8_t tile_low = 0;
+    uint8_t tile_high = 0;
+    bool window = false;
+
+    uint8_t startup_dots = 0;  // Dummy fetch at the start of the line
+    uint8_t discard = 0;       // Pixels dropped for the fine scroll
+    uint8_t lcd_x = 0;
+
+    // Sprites of the line ordered by X then OAM index
+    std::array<Sprite, 10> sprites;
+    uint8_t sprite_count = 0;
+    uint8_t next_sprite = 0;
+    uint8_t sprite_dots = 0;  // Remaining dots of the current sprite fetch
+};
+
+// A copy of the PPU leaves the caches it derives from VRAM and OAM behind, it is only good to be assigned back to a
+// running PPU, which keeps its own caches and brings them up to date through the VRAM and OAM dirty trackers.
 class PPU {
    public:
-    explicit PPU(Bus& bus, IO& io);
+    PPU(Bus& bus, MachineState& state, VRAM& vram, OAM& oam, Screen& screen);
+
+    // Points the PPU to the components and state of another machine, after a copy
+    void link(Bus& bus, MachineState& state, VRAM& vram, OAM& oam, Screen& screen);
 
     void init();
-    void tick();
+    void sync();
+    void reschedule();
+
+    // Bus tick at which the PPU raises its next interrupt, the bus syncs the PPU when it is reached
+    [[nodiscard]] uint64_t next_event() const { return state_->ppu_next_event; }
 
-    [[nodiscard]] const uint32_t* get_framebuffer() const { return display_buffer_.load()->data(); }
+    // Last presented frame, consistent from any thread
+    [[nodiscard]] PresentedFrame get_presented_frame() const { return presented_.load(); }
+    [[nodiscard]] const uint32_t* get_framebuffer(const PresentedFrame& frame) const { return screen_->framebuffers[frame.buffer].data(); }
+    [[nodiscard]] const Palette& get_palette() const { return default_palette_; }
     [[nodiscard]] bool is_frame_ready() const { return frame_ready_; }
+    // Hash of the shade indices of the displayed frame, combined from the hashes of its lines
+    [[nodiscard]] uint64_t get_frame_hash() const { return presented_.load().hash; }
+    // Number of presented frames since init
+    [[nodiscard]] uint64_t get_frame_count() const { return frame_count_; }
+    // Only meaningful right after a sync
+    [[nodiscard]] uint64_t hash_state() const;
     void mark_frame_consumed() { frame_ready_ = false; }
+    // Redraws every line from the next one on, after a copy of the PPU which left the screen behind
+    void invalidate_lines() {
+        line_fingerprints_ = {};
+        frame_blank_filled_ = false;
+    }
 
     enum class Mode {
         HBLANK = 0,
@@ -44,55 +129,145 @@ class PPU {
         DRAWING,
     };
 
+    enum class Engine {
+        SCANLINE = 0,  // Whole line rendered at the end of a fixed length mode 3
+        FIFO,          // Pixel FIFO stepped every dot, handles mid-scanline changes and the variable mode 3 length
+    };
+
+    // Receives the shades of every presented frame, nullptr to stop
+    void set_recorder(VideoRecorder* recorder) { recorder_ = recorder; }
+    [[nodiscard]] VideoRecorder* get_recorder() const { return recorder_; }
+
+    // Takes effect on the next line
+    void set_engine(const Engine engine) { engine_ = engine; }
+    [[nodiscard]] Engine get_engine() const { return engine_; }
+
    private:
-    Bus& bus_;
-
-    uint8_t& lcdc_;
-    uint8_t& stat_;
-    uint8_t& scy_;
-    uint8_t& scx_;
-    uint8_t& ly_;
-    uint8_t& lyc_;
-    uint8_t& dma_;
-    uint8_t& bgp_;
-    uint8_t& obp0_;
-    uint8_t& obp1_;
-    uint8_t& wy_;
-    uint8_t& wx_;
-    uint8_t& if_;
+    friend struct PPUBenchmark;  // Renders single lines, bench/ppu_bench.cpp
+
+    static constexpr uint64_t NEVER = MachineState::NEVER;
+    static constexpr uint8_t MAX_LINE_SPRITES = 10;
+
+    Bus* bus_;
+    VRAM* vram_;
+    OAM* oam_;
+    Screen* screen_;
+    MachineState* state_;
+
+    uint8_t& lcdc() const { return state_->io[REG_LCDC_ADDR - IO_ADDR_START]; }
+    uint8_t& stat() const { return state_->io[REG_STAT_ADDR - IO_ADDR_START]; }
+    uint8_t& scy() const { return state_->io[REG_SCY_ADDR - IO_ADDR_START]; }
+    uint8_t& scx() const { return state_->io[REG_SCX_ADDR - IO_ADDR_START]; }
+    uint8_t& ly() const { return state_->io[REG_LY_ADDR - IO_ADDR_START]; }
+    uint8_t& lyc() const { return state_->io[REG_LYC_ADDR - IO_ADDR_START]; }
+    uint8_t& dma() const { return state_->io[REG_DMA_ADDR - IO_ADDR_START]; }
+    uint8_t& bgp() const { return state_->io[REG_BGP_ADDR - IO_ADDR_START]; }
+    uint8_t& obp0() const { return state_->io[REG_OBP0_ADDR - IO_ADDR_START]; }
+    uint8_t& obp1() const { return state_->io[REG_OBP1_ADDR - IO_ADDR_START]; }
+    uint8_t& wy() const { return state_->io[REG_WY_ADDR - IO_ADDR_START]; }
+    uint8_t& wx() const { return state_->io[REG_WX_ADDR - IO_ADDR_START]; }
+    uint8_t& interrupt_flags() const { return state_->io[REG_IF_ADDR - IO_ADDR_START]; }
 
     Mode mode_ = Mode::OAMSCAN;
+    Engine engine_ = Engine::SCANLINE;
+    Engine line_engine_ = Engine::SCANLINE;  // Engine drawing the current line
+    uint32_t mode3_length_ = 172;
+    PixelFifo fifo_;
+    VideoRecorder* recorder_ = nullptr;
     uint32_t gfx_counter_ = 0;
     uint8_t window_line_counter_ = 0;
     bool frame_ready_ = false;
     bool frame_blank_filled_ = false;
-    uint32_t default_palette_[4] = {
+    Palette default_palette_ = {
         0xFFD0F8E0,
         0xFF70C088,
         0xFF566834,
         0xFF201808,
     };
-    std::vector<Sprite> scanline_sprites_;
+    std::array<Sprite, MAX_LINE_SPRITES> scanline_sprites_;
+    uint8_t scanline_sprite_count_ = 0;
+
+    // Tile maps pre-rendered as 256x256 color ids, for both tile data addressing modes
+    struct MapCache {
+        std::array<uint8_t, 256 * 256> pixels{};
+        std::bitset<32 * 32> stale_cells = std::bitset<32 * 32>().set();  // Tiles to redraw before the next use
+        std::array<uint32_t, 32> row_versions{};  // Bumped when a tile of the row is redrawn
+    };
+
+    // Derived from VRAM and OAM, on the heap so that copies of the PPU stay small
+    struct Caches {
+        // Sprites of each line in drawing order (right to left, highest OAM index first), rebuilt when OAM or the sprite size change
+        std::array<Sprite, 40> oam_sprites;
+        std::array<std::array<uint8_t, MAX_LINE_SPRITES>, SCREEN_HEIGHT> line_sprites{};
+        std::array<uint8_t, SCREEN_HEIGHT> line_sprite_count{};
+        uint8_t sprite_index_obj_size = 0;
+
+        std::array<MapCache, 4> map_caches;  // Indexed by map * 2 + signed addressing
+        std::array<uint32_t, 384> tile_versions{};  // Bumped when a tile of the tile data is written
+    };
+
+    // Owns the caches, a copy starts without them and an assignment keeps its own
+    class CachesPtr {
+       public:
+        CachesPtr() : caches_(std::make_unique<Caches>()) {}
+        CachesPtr(const CachesPtr&) {}
+        CachesPtr& operator=(const CachesPtr&) { return *this; }
+
+        Caches* operator->() const { return caches_.get(); }
+
+       private:
+        std::unique_ptr<Caches> caches_;
+    };
 
-    // Buffers
-    std::array<uint32_t, 160 * 144> buffer_a_{0};
-    std::array<uint32_t, 160 * 144> buffer_b_{0};
-    std::atomic<std::array<uint32_t, 160 * 144>*> display_buffer_;
-    std::array<uint32_t, 160 * 144>* render_buffer_;
-    std::array<uint8_t, 160 * 144> pixel_ids_;
+    CachesPtr caches_;
+    uint8_t oam_observer_;
+    uint8_t vram_observer_;
+
+    // Inputs of each line of both buffers, the lines whose inputs did not change are not rendered again
+    std::array<std::array<uint64_t, SCREEN_HEIGHT>, 2> line_fingerprints_{};
+
+    // Hash of each line of both buffers, kept when a line is skipped
+    std::array<std::array<uint64_t, SCREEN_HEIGHT>, 2> line_hashes_{};
+    uint64_t frame_count_ = 0;
+
+    // Screen buffers, swapped when a frame is presented
+    SeqLock<PresentedFrame> presented_;
+    uint8_t render_index_ = 1;
+    std::array<uint8_t, SCREEN_WIDTH> pixel_ids_;  // Color ids of the line being rendered
 
     // Utility functions
+    bool run(uint64_t dots);
+    [[nodiscard]] uint32_t mode_length() const;
     void inc_ly();
     void inc_window_line_counter();
-    void set_pixel(uint8_t x, uint8_t y, uint32_t color);
+    void set_pixel(uint8_t x, uint8_t y, uint8_t shade);
     uint8_t get_tile_pixel(uint16_t tile_data_addr, uint8_t pixel_x, uint8_t pixel_y) const;
+    void build_sprite_index();
     void evaluate_sprites();
-    void fill_line(uint32_t color);
+    [[nodiscard]] static uint16_t tile_index(uint8_t tile_id, bool signed_addressing);
+    void collect_vram_changes();
+    void refresh_map_cache_row(bool map_1, bool signed_addressing, uint8_t tile_row);
+    const uint8_t* get_map_cache_line(bool map_1, bool signed_addressing, uint8_t y);
+    uint32_t get_map_cache_row_version(bool map_1, bool signed_addressing, uint8_t y);
+    [[nodiscard]] int render_buffer_index() const { return render_index_; }
+    [[nodiscard]] uint8_t* render_shades() { return screen_->shades[render_index_].data(); }
+    void mark_line_drawn() { screen_->lines.mark(render_index_ * SCREEN_HEIGHT + ly()); }
+    uint64_t line_fingerprint();
+    void apply_bg_palette(int start_x);
+    void fill_line(uint8_t shade);
     void render_bg_line();
     void render_obj_line();
     void render_window_line();
     void render_scanline();
     void present_frame();
+
+    // Pixel FIFO engine (ppu_fifo.cpp)
+    void fifo_start_line();
+    bool fifo_step();
+    void fifo_fetch_tile();
+    void fifo_push_bg();
+    void fifo_fetch_sprite(const Sprite& sprite);
+    void fifo_output_pixel();
 };
 
 }  // namespace WindGB
\ No newline at end of file
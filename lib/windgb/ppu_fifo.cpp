@@ -0,0 +1,178 @@
+#include <algorithm>
+#include <cstdint>
+
+#include "common.hpp"
+#include "ppu.hpp"
+#include "ram.hpp"
+
+namespace WindGB {
+
+void PPU::fifo_start_line() {
+    fifo_ = PixelFifo{};
+    fifo_.startup_dots = 6;
+    fifo_.discard = scx() & 0x07;
+
+    // Sprites are fetched from left to right, lowest OAM index first on ties: the reverse of the drawing order
+    fifo_.sprite_count = scanline_sprite_count_;
+    std::reverse_copy(scanline_sprites_.begin(), scanline_sprites_.begin() + scanline_sprite_count_, fifo_.sprites.begin());
+}
+
+bool PPU::fifo_step() {
+    auto& fifo = fifo_;
+
+    if (fifo.startup_dots > 0) {
+        fifo.startup_dots--;
+        return false;
+    }
+
+    if (fifo.sprite_dots > 0) {  // BG fetcher and pixel output are stalled while a sprite is fetched
+        if (--fifo.sprite_dots == 0) {
+            fifo_fetch_sprite(fifo.sprites[fifo.next_sprite++]);
+        }
+        return false;
+    }
+
+    // A sprite starts at this position, no pixel can be output before it is fetched
+    const bool sprite_pending = GET_BIT(lcdc(), 1) && fifo.discard == 0 && fifo.next_sprite < fifo.sprite_count &&
+                                fifo.sprites[fifo.next_sprite].x <= fifo.lcd_x + 8;
+    if (sprite_pending && fifo.bg_size > 0) {
+        // The BG fetcher finishes its current tile first
+        const uint8_t fetch_left = fifo.fetch_dots < 6 ? 6 - fifo.fetch_dots : 0;
+        if (fetch_left > 0) {
+            fifo_fetch_tile();
+            fifo.fetch_dots = 6;
+        }
+        fifo.sprite_dots = 6 + (fetch_left > 0 ? fetch_left - 1 : 0);
+        return false;
+    }
+
+    // Window start
+    if (!fifo.window && GET_BIT(lcdc(), 0) && GET_BIT(lcdc(), 5) && wy() <= ly() && wx() < 167 && fifo.lcd_x + 7 >= wx()) {
+        fifo.window = true;
+        fifo.bg_size = 0;
+        fifo.fetch_dots = 0;
+        fifo.fetch_x = 0;
+        if (wx() < 7) {
+            fifo.discard = 7 - wx();
+        }
+    }
+
+    // BG/window fetcher, each step takes 2 dots and the tile is pushed once the FIFO is empty
+    fifo.fetch_dots++;
+    if (fifo.fetch_dots == 6) {
+        fifo_fetch_tile();
+    } else if (fifo.fetch_dots > 6 && fifo.bg_size == 0) {
+        fifo_push_bg();
+    }
+
+    // Pixel output
+    if (fifo.bg_size == 0 || sprite_pending) return false;
+    fifo_output_pixel();
+    return fifo.lcd_x >= SCREEN_WIDTH;
+}
+
+void PPU::fifo_fetch_tile() {
+    auto& fifo = fifo_;
+
+    uint16_t tile_map_addr;
+    uint8_t pixel_row;
+    if (fifo.window) {
+        const uint16_t tile_map_base = GET_BIT(lcdc(), 6) ? TILE_MAP_1 : TILE_MAP_0;
+        tile_map_addr = tile_map_base + (window_line_counter_ / 8) * 32 + (fifo.fetch_x & 0x1F);
+        pixel_row = window_line_counter_ % 8;
+    } else {
+        const uint16_t tile_map_base = GET_BIT(lcdc(), 3) ? TILE_MAP_1 : TILE_MAP_0;
+        const uint8_t bg_y = (ly() + scy()) & 0xFF;
+        tile_map_addr = tile_map_base + (bg_y / 8) * 32 + (((scx() / 8) + fifo.fetch_x) & 0x1F);
+        pixel_row = bg_y % 8;
+    }
+    const uint8_t* vram = vram_->get_data();
+    fifo.tile_id = vram[tile_map_addr - VRAM_ADDR_START];
+
+    uint16_t tile_data_addr;
+    if (!GET_BIT(lcdc(), 4)) {  // Signed addressing
+        tile_data_addr = 0x9000 + (static_cast<int8_t>(fifo.tile_id) * 16);
+    } else {
+        tile_data_addr = TILE_DATA_0 + (fifo.tile_id * 16);
+    }
+    fifo.tile_low = vram[tile_data_addr + pixel_row * 2 - VRAM_ADDR_START];
+    fifo.tile_high = vram[tile_data_addr + pixel_row * 2 + 1 - VRAM_ADDR_START];
+}
+
+void PPU::fifo_push_bg() {
+    auto& fifo = fifo_;
+
+    for (int bit = 7; bit >= 0; bit--) {
+        const uint8_t color = (((fifo.tile_high >> bit) & 1) << 1) | ((fifo.tile_low >> bit) & 1);
+        fifo.bg[(fifo.bg_head + fifo.bg_size) % fifo.bg.size()] = color;
+        fifo.bg_size++;
+    }
+    fifo.fetch_dots = 0;
+    fifo.fetch_x++;
+}
+
+void PPU::fifo_fetch_sprite(const Sprite& sprite) {
+    auto& fifo = fifo_;
+    const uint16_t obj_size = GET_BIT(lcdc(), 2) ? 16 : 8;
+
+    uint8_t sprite_y = ly() - (sprite.y - 16);
+    if (sprite.y_flip) sprite_y = obj_size - 1 - sprite_y;
+    if (sprite_y >= obj_size) return;
+
+    const uint8_t tile_index = obj_size == 16 ? sprite.tile_index & 0xFE : sprite.tile_index;
+    const uint16_t tile_addr = TILE_DATA_0 + tile_index * 16;
+
+    // Pixels left of the screen are dropped
+    const uint8_t skip = sprite.x < 8 ? 8 - sprite.x : 0;
+
+    for (uint8_t x = skip; x < 8; x++) {
+        const uint8_t sprite_x = sprite.x_flip ? 7 - x : x;
+        const uint8_t color = get_tile_pixel(tile_addr, sprite_x, sprite_y);
+        const uint8_t slot = x - skip;
+        auto& pixel = fifo.obj[(fifo.obj_head + slot) % fifo.obj.size()];
+
+        if (slot >= fifo.obj_size) {
+            pixel = {color, sprite.palette, sprite.bg_priority};
+            fifo.obj_size++;
+        } else if (pixel.color == 0) {  // Sprites fetched earlier keep the priority
+            pixel = {color, sprite.palette, sprite.bg_priority};
+        }
+    }
+}
+
+void PPU::fifo_output_pixel() {
+    auto& fifo = fifo_;
+
+    const uint8_t bg_color = fifo.bg[fifo.bg_head];
+    fifo.bg_head = (fifo.bg_head + 1) % fifo.bg.size();
+    fifo.bg_size--;
+
+    if (fifo.discard > 0) {
+        fifo.discard--;
+        return;
+    }
+
+    PixelFifo::ObjPixel obj = {0, false, false};
+    if (fifo.obj_size > 0) {
+        obj = fifo.obj[fifo.obj_head];
+        fifo.obj_head = (fifo.obj_head + 1) % fifo.obj.size();
+        fifo.obj_size--;
+    }
+
+    uint8_t shade;
+    const bool bg_enabled = GET_BIT(lcdc(), 0);
+    const uint8_t bg_id = bg_enabled ? bg_color : 0;
+    if (obj.color != 0 && GET_BIT(lcdc(), 1) && !(obj.bg_priority && bg_id != 0)) {
+        const uint8_t palette = obj.palette ? obp1() : obp0();
+        shade = (palette >> (obj.color * 2)) & 0x03;
+    } else if (bg_enabled) {
+        shade = (bgp() >> (bg_id * 2)) & 0x03;
+    } else {
+        shade = 0;
+    }
+
+    set_pixel(fifo.lcd_x, ly(), shade);
+    fifo.lcd_x++;
+}
+
+}  // namespace WindGB
@@ -0,0 +1,159 @@
+#include "profiler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+
+#include "bus.hpp"
+
+namespace WindGB {
+
+// ROM bank 0, switchable ROM, VRAM, external RAM, WRAM and the rest, labels never span two of them
+static uint8_t memory_region(const uint16_t addr) {
+    if (addr < 0x4000) return 0;
+    if (addr < 0x8000) return 1;
+    if (addr < 0xA000) return 2;
+    if (addr < 0xC000) return 3;
+    if (addr < 0xE000) return 4;
+    return 5;
+}
+
+SymbolTable SymbolTable::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Unable to open the symbol file '" + path + "'");
+    }
+
+    SymbolTable table;
+    std::string line;
+    while (std::getline(file, line)) {
+        if (const size_t comment = line.find(';'); comment != std::string::npos) line.resize(comment);
+
+        unsigned bank = 0;
+        unsigned addr = 0;
+        char name[256];
+        if (std::sscanf(line.c_str(), "%x:%x %255s", &bank, &addr, name) != 3) continue;
+        if (std::string_view(name).find('.') != std::string_view::npos) continue;  // Local label
+
+        table.add(bank, addr, name);
+    }
+    return table;
+}
+
+void SymbolTable::add(const uint16_t bank, const uint16_t addr, const std::string& name) {
+    // Symbol files use bank 0 for the fixed ROM bank and the RAM areas
+    symbols_[make_location(addr < 0x4000 || addr >= 0x8000 ? 0 : bank, addr)] = name;
+}
+
+const std::string* SymbolTable::find(const CodeLocation location) const {
+    uint16_t bank = location >> 16;
+    const uint16_t addr = location & 0xFFFF;
+    if (bank == Bus::NO_BANK) bank = 0;
+
+    auto it = symbols_.upper_bound(make_location(bank, addr));
+    if (it == symbols_.begin()) return nullptr;
+    --it;
+
+    if ((it->first >> 16) != bank || memory_region(it->first & 0xFFFF) != memory_region(addr)) return nullptr;
+    return &it->second;
+}
+
+Profiler::Profiler() { reset(); }
+
+void Profiler::reset() {
+    nodes_.assign(1, Node{ROOT, 0});
+    children_.clear();
+    stack_.clear();
+    current_node_ = ROOT;
+    samples_.clear();
+    total_cycles_ = 0;
+}
+
+void Profiler::enter(const CodeLocation target, const uint16_t sp) {
+    if (stack_.size() < MAX_DEPTH) {
+        const uint64_t key = (static_cast<uint64_t>(current_node_) << 32) | target;
+        auto [it, inserted] = children_.try_emplace(key, static_cast<uint32_t>(nodes_.size()));
+        if (inserted) nodes_.push_back(Node{current_node_, target});
+        current_node_ = it->second;
+    }
+    stack_.push_back(Frame{current_node_, sp});
+}
+
+void Profiler::leave(const uint16_t sp) {
+    // Pops every frame whose return address is now above the stack pointer, which also unwinds frames left by code
+    // that discards its return address instead of returning
+    while (!stack_.empty() && stack_.back().sp < sp) stack_.pop_back();
+    current_node_ = stack_.empty() ? ROOT : stack_.back().node;
+}
+
+std::string Profiler::node_name(const uint32_t node) const {
+    if (node == ROOT) return "[root]";
+
+    const CodeLocation entry = nodes_[node].entry;
+    if (const std::string* symbol = symbols_.find(entry)) return *symbol;
+
+    char name[16];
+    if ((entry >> 16) == Bus::NO_BANK) {
+        std::snprintf(name, sizeof(name), "--:%04X", entry & 0xFFFF);
+    } else {
+        std::snprintf(name, sizeof(name), "%02X:%04X", entry >> 16, entry & 0xFFFF);
+    }
+    return name;
+}
+
+std::string Profiler::function_name(const uint32_t node, const CodeLocation location) const {
+    if (const std::string* symbol = symbols_.find(location)) return *symbol;
+    return node_name(node);
+}
+
+std::vector<ProfileEntry> Profiler::get_functions() const {
+    std::unordered_map<std::string, uint64_t> functions;
+    for (const auto& [key, cycles] : samples_) {
+        functions[function_name(key >> 32, key & 0xFFFFFFFF)] += cycles;
+    }
+
+    std::vector<ProfileEntry> entries;
+    entries.reserve(functions.size());
+    for (auto& [name, cycles] : functions) entries.push_back(ProfileEntry{name, cycles});
+    std::ranges::sort(entries, [](const ProfileEntry& a, const ProfileEntry& b) { return a.cycles > b.cycles; });
+    return entries;
+}
+
+void Profiler::write_collapsed(const std::string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the profile '" + path + "'");
+    }
+
+    std::unordered_map<uint32_t, std::string> stacks;  // Node -> "caller;callee"
+    std::map<std::string, uint64_t> lines;
+    for (const auto& [key, cycles] : samples_) {
+        const uint32_t node = key >> 32;
+
+        auto [it, inserted] = stacks.try_emplace(node);
+        if (inserted) {
+            std::vector<uint32_t> path_nodes;
+            for (uint32_t n = node; n != ROOT; n = nodes_[n].parent) path_nodes.push_back(n);
+
+            it->second = node_name(ROOT);
+            for (auto n = path_nodes.rbegin(); n != path_nodes.rend(); ++n) {
+                it->second += ';';
+                it->second += node_name(*n);
+            }
+        }
+
+        // The function the PC is in when it was jumped to rather than called
+        std::string stack = it->second;
+        if (const std::string function = function_name(node, key & 0xFFFFFFFF); function != node_name(node)) {
+            stack += ';';
+            stack += function;
+        }
+        lines[stack] += cycles;
+    }
+
+    for (const auto& [stack, cycles] : lines) file << stack << ' ' << cycles << '\n';
+}
+
+}  // namespace WindGB
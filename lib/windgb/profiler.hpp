@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace WindGB {
+
+// Guest code address, ROM bank in the high half (Bus::NO_BANK outside of the cartridge ROM) and address in the low half
+using CodeLocation = uint32_t;
+
+[[nodiscard]] constexpr CodeLocation make_location(const uint16_t bank, const uint16_t addr) { return (static_cast<uint32_t>(bank) << 16) | addr; }
+
+// Global labels of an RGBDS symbol file ("BB:AAAA Name" per line), local labels are folded into their parent
+class SymbolTable {
+   public:
+    static SymbolTable load(const std::string& path);
+
+    void add(uint16_t bank, uint16_t addr, const std::string& name);
+    // Closest label at or before the location in the same memory region, nullptr when there is none
+    [[nodiscard]] const std::string* find(CodeLocation location) const;
+    [[nodiscard]] bool empty() const { return symbols_.empty(); }
+
+   private:
+    std::map<CodeLocation, std::string> symbols_;
+};
+
+struct ProfileEntry {
+    std::string name;
+    uint64_t cycles;
+};
+
+// Attributes the emulated M-cycles of every instruction to its (bank, PC) and to the call stack it runs in.
+// The call stack is shadowed from CALL, RST and interrupt dispatches, and unwound when a return pops past a frame.
+class Profiler {
+   public:
+    Profiler();
+
+    void set_symbols(SymbolTable symbols) { symbols_ = std::move(symbols); }
+    void reset();
+
+    // Called by the CPU after each step while profiling
+    void add_cycles(const CodeLocation location, const uint32_t cycles) {
+        samples_[(static_cast<uint64_t>(current_node_) << 32) | location] += cycles;
+        total_cycles_ += cycles;
+    }
+    // sp is the stack pointer after the return address was pushed
+    void enter(CodeLocation target, uint16_t sp);
+    // sp is the stack pointer after the return address was popped
+    void leave(uint16_t sp);
+
+    [[nodiscard]] uint64_t get_total_cycles() const { return total_cycles_; }
+    // Self cycles per function, most expensive first. Functions are symbols when loaded, call targets otherwise.
+    [[nodiscard]] std::vector<ProfileEntry> get_functions() const;
+    // One "caller;callee;function cycles" line per stack, the format read by flamegraph.pl and speedscope
+    void write_collapsed(const std::string& path) const;
+
+   private:
+    static constexpr uint32_t ROOT = 0;
+    static constexpr size_t MAX_DEPTH = 64;  // Deeper calls stay in the deepest frame
+
+    struct Node {
+        uint32_t parent;
+        CodeLocation entry;
+    };
+    struct Frame {
+        uint32_t node;
+        uint16_t sp;
+    };
+
+    SymbolTable symbols_;
+    std::vector<Node> nodes_;
+    std::unordered_map<uint64_t, uint32_t> children_;  // Parent node << 32 | entry
+    std::vector<Frame> stack_;
+    uint32_t current_node_ = ROOT;
+
+    std::unordered_map<uint64_t, uint64_t> samples_;  // Node << 32 | location
+    uint64_t total_cycles_ = 0;
+
+    [[nodiscard]] std::string node_name(uint32_t node) const;
+    [[nodiscard]] std::string function_name(uint32_t node, CodeLocation location) const;
+};
+
+}  // namespace WindGB
@@ -7,42 +7,97 @@ namespace WindGB {
 
 uint8_t WRAM::read(const uint16_t addr) const {
     const uint16_t index = addr - WRAM_ADDR_START;
-    return data_.at(index);
+    return state_->wram.at(index);
 }
 
 void WRAM::write(const uint16_t addr, const uint8_t data) {
     const uint16_t index = addr - WRAM_ADDR_START;
-    data_[index] = data;
+    state_->wram[index] = data;
+    pages_.mark(index / PAGE_SIZE);
+}
+
+size_t WRAM::copy_pages(const MachineState& source, const Pages::Bitmap& pages) {
+    return WindGB::copy_pages(source.wram.data(), state_->wram.data(), state_->wram.size(), pages, &pages_);
 }
 
 uint8_t HRAM::read(const uint16_t addr) const {
     const uint16_t index = addr - HRAM_ADDR_START;
-    return data_.at(index);
+    return state_->hram.at(index);
 }
 
 void HRAM::write(const uint16_t addr, const uint8_t data) {
     const uint16_t index = addr - HRAM_ADDR_START;
-    data_[index] = data;
+    state_->hram[index] = data;
 }
 
 uint8_t VRAM::read(const uint16_t addr) const {
     const uint16_t index = addr - VRAM_ADDR_START;
-    return data_.at(index);
+    return state_->vram.at(index);
 }
 
 void VRAM::write(const uint16_t addr, uint8_t data) {
     const uint16_t index = addr - VRAM_ADDR_START;
-    data_[index] = data;
+    state_->vram[index] = data;
+    pages_.mark(index / PAGE_SIZE);
+
+    if (index < TILE_MAP_0 - VRAM_ADDR_START) {
+        dirty_tiles_.mark(index / 16);
+    } else {
+        dirty_map_rows_.mark((index - (TILE_MAP_0 - VRAM_ADDR_START)) / 32);
+    }
+}
+
+uint8_t VRAM::add_observer() {
+    const uint8_t observer = dirty_tiles_.add_observer();
+    dirty_map_rows_.add_observer();
+    return observer;
+}
+
+void VRAM::clear_dirty(const uint8_t observer) {
+    dirty_tiles_.clear(observer);
+    dirty_map_rows_.clear(observer);
+}
+
+size_t VRAM::copy_pages(const MachineState& source, const Pages::Bitmap& pages) {
+    mark_dirty(pages);
+    return WindGB::copy_pages(source.vram.data(), state_->vram.data(), state_->vram.size(), pages, &pages_);
+}
+
+void VRAM::mark_dirty(const Pages::Bitmap& pages) {
+    if (pages.all()) {
+        dirty_tiles_.mark_all();
+        dirty_map_rows_.mark_all();
+        return;
+    }
+
+    constexpr size_t TILES_PER_PAGE = PAGE_SIZE / 16;
+    constexpr size_t ROWS_PER_PAGE = PAGE_SIZE / 32;
+    constexpr size_t TILE_PAGES = TILE_COUNT / TILES_PER_PAGE;
+    for (size_t page = 0; page < pages.size(); page++) {
+        if (!pages[page]) continue;
+        if (page < TILE_PAGES) {
+            for (size_t tile = page * TILES_PER_PAGE; tile < (page + 1) * TILES_PER_PAGE; tile++) dirty_tiles_.mark(tile);
+        } else {
+            for (size_t row = (page - TILE_PAGES) * ROWS_PER_PAGE; row < (page - TILE_PAGES + 1) * ROWS_PER_PAGE; row++) dirty_map_rows_.mark(row);
+        }
+    }
 }
 
 uint8_t OAM::read(const uint16_t addr) const {
     const uint16_t index = addr - OAM_ADDR_START;
-    return data_.at(index);
+    return state_->oam.at(index);
 }
 
 void OAM::write(const uint16_t addr, const uint8_t data) {
     const uint16_t index = addr - OAM_ADDR_START;
-    data_[index] = data;
+    state_->oam[index] = data;
+    dirty_entries_.mark(index / 4);
+    pages_.mark(0);
+}
+
+size_t OAM::copy_pages(const MachineState& source, const Pages::Bitmap& pages) {
+    mark_dirty(pages);
+    return WindGB::copy_pages(source.oam.data(), state_->oam.data(), state_->oam.size(), pages, &pages_);
 }
 
 }  // namespace WindGB
\ No newline at end of file
@@ -3,43 +3,114 @@
 #include <array>
 
 #include "component.hpp"
+#include "dirty.hpp"
+#include "hash.hpp"
+#include "machine_state.hpp"
 
 namespace WindGB {
 
+// The memories live in the machine state, the components map them on the bus and track their writes
 class WRAM final : public Component {
    public:
+    explicit WRAM(MachineState& state) : state_(&state) {}
+    // Points the memory to the state of another machine, after a copy
+    void link(MachineState& state) { state_ = &state; }
+
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
 
+    [[nodiscard]] uint64_t hash_state() const { return hash_bytes(state_->wram.data(), state_->wram.size()); }
+
+    using Pages = PageTracker<0x2000 / PAGE_SIZE>;
+    [[nodiscard]] Pages& get_pages() { return pages_; }
+    // Copies the given pages of the WRAM of source, returns the bytes copied
+    size_t copy_pages(const MachineState& source, const Pages::Bitmap& pages);
+
    private:
-    std::array<uint8_t, 0x2000> data_ = {0};
+    MachineState* state_;
+    Pages pages_;
 };
 
+// Not tracked, it lies in the registers part of the machine state which snapshots always copy
 class HRAM final : public Component {
    public:
+    explicit HRAM(MachineState& state) : state_(&state) {}
+    void link(MachineState& state) { state_ = &state; }
+
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
 
+    [[nodiscard]] uint64_t hash_state() const { return hash_bytes(state_->hram.data(), state_->hram.size()); }
+
    private:
-    std::array<uint8_t, 0x007F> data_ = {0};
+    MachineState* state_;
 };
 
 class VRAM final : public Component {
    public:
+    static constexpr uint16_t TILE_COUNT = 384;     // 16 bytes tiles in 0x8000-0x97FF
+    static constexpr uint16_t MAP_ROW_COUNT = 64;   // 32 bytes rows of TILE_MAP_0 then TILE_MAP_1
+
+    explicit VRAM(MachineState& state) : state_(&state) {}
+    void link(MachineState& state) { state_ = &state; }
+
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
 
+    [[nodiscard]] const uint8_t* get_data() const { return state_->vram.data(); }
+    [[nodiscard]] uint64_t hash_state() const { return hash_bytes(state_->vram.data(), state_->vram.size()); }
+
+    // Returns the observer id to use with the dirty bitmaps
+    uint8_t add_observer();
+    [[nodiscard]] const std::bitset<TILE_COUNT>& get_dirty_tiles(const uint8_t observer) const { return dirty_tiles_.get(observer); }
+    [[nodiscard]] const std::bitset<MAP_ROW_COUNT>& get_dirty_map_rows(const uint8_t observer) const { return dirty_map_rows_.get(observer); }
+    void clear_dirty(uint8_t observer);
+
+    using Pages = PageTracker<0x2000 / PAGE_SIZE>;
+    [[nodiscard]] Pages& get_pages() { return pages_; }
+    // Copies the given pages of the VRAM of source, returns the bytes copied
+    size_t copy_pages(const MachineState& source, const Pages::Bitmap& pages);
+    // Marks the tiles and map rows of the pages dirty for every observer, after they were copied
+    void mark_dirty(const Pages::Bitmap& pages);
+
    private:
-    std::array<uint8_t, 0x2000> data_ = {0};
+    MachineState* state_;
+    DirtyTracker<TILE_COUNT> dirty_tiles_;
+    DirtyTracker<MAP_ROW_COUNT> dirty_map_rows_;
+    Pages pages_;
 };
 
 class OAM final : public Component {
    public:
+    explicit OAM(MachineState& state) : state_(&state) {}
+    void link(MachineState& state) { state_ = &state; }
+
     [[nodiscard]] uint8_t read(uint16_t addr) const override;
     void write(uint16_t addr, uint8_t data) override;
 
+    static constexpr uint8_t ENTRY_COUNT = 40;
+
+    [[nodiscard]] const uint8_t* get_data() const { return state_->oam.data(); }
+    [[nodiscard]] uint64_t hash_state() const { return hash_bytes(state_->oam.data(), state_->oam.size()); }
+
+    // Returns the observer id to use with the dirty bitmap
+    uint8_t add_observer() { return dirty_entries_.add_observer(); }
+    [[nodiscard]] const std::bitset<ENTRY_COUNT>& get_dirty_entries(const uint8_t observer) const { return dirty_entries_.get(observer); }
+    void clear_dirty(const uint8_t observer) { dirty_entries_.clear(observer); }
+
+    using Pages = PageTracker<1>;
+    [[nodiscard]] Pages& get_pages() { return pages_; }
+    // Copies the given pages of the OAM of source, returns the bytes copied
+    size_t copy_pages(const MachineState& source, const Pages::Bitmap& pages);
+    // Marks the entries of the pages dirty for every observer, after they were copied
+    void mark_dirty(const Pages::Bitmap& pages) {
+        if (pages.any()) dirty_entries_.mark_all();
+    }
+
    private:
-    std::array<uint8_t, 0x00A0> data_ = {0};
+    MachineState* state_;
+    DirtyTracker<ENTRY_COUNT> dirty_entries_;
+    Pages pages_;
 };
 
 }  // namespace WindGB
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace WindGB {
+
+// Value published by one writer thread and read by any thread. The writer never waits, readers retry while a store
+// is in progress. The value is copied word by word through relaxed atomics so that a torn read is never a data race.
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable_v<T> && sizeof(T) % sizeof(uint64_t) == 0);
+
+   public:
+    SeqLock() = default;
+    // Copies the last stored value, the copy itself is not synchronized with the writer
+    SeqLock(const SeqLock& other) { store(other.load()); }
+    SeqLock& operator=(const SeqLock& other) {
+        store(other.load());
+        return *this;
+    }
+
+    // Writer side
+    void store(const T& value) {
+        const auto words = std::bit_cast<std::array<uint64_t, WORDS>>(value);
+
+        const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1, std::memory_order_relaxed);  // Odd while the words are written
+        std::atomic_thread_fence(std::memory_order_release);
+        for (size_t i = 0; i < WORDS; i++) words_[i].store(words[i], std::memory_order_relaxed);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    [[nodiscard]] T load() const {
+        std::array<uint64_t, WORDS> words;
+        uint32_t sequence;
+        do {
+            sequence = sequence_.load(std::memory_order_acquire);
+            for (size_t i = 0; i < WORDS; i++) words[i] = words_[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((sequence & 1) || sequence != sequence_.load(std::memory_order_relaxed));
+
+        return std::bit_cast<T>(words);
+    }
+
+   private:
+    static constexpr size_t WORDS = sizeof(T) / sizeof(uint64_t);
+
+    alignas(64) std::atomic<uint32_t> sequence_ = 0;
+    std::array<std::atomic<uint64_t>, WORDS> words_{};
+};
+
+}  // namespace WindGB
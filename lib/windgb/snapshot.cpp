@@ -0,0 +1,8 @@
+#include "snapshot.hpp"
+
+namespace WindGB {
+
+Snapshot::Snapshot() = default;
+Snapshot::~Snapshot() = default;
+
+}  // namespace WindGB
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "cartridge.hpp"
+#include "machine_state.hpp"
+#include "perf_counters.hpp"
+#include "ppu.hpp"
+
+namespace WindGB {
+
+class GameBoy;
+
+// Machine state saved by GameBoy::save_snapshot. Saving into the same snapshot again, or restoring it into the machine
+// it was saved from, only copies the 256 bytes pages of WRAM, VRAM, OAM and cartridge RAM and the screen lines written
+// in between. The registers, IO, HRAM and the state of the PPU are always copied. The caches the PPU derives from VRAM
+// and OAM are not saved, a restore only invalidates the parts of them whose pages it copies.
+class Snapshot {
+   public:
+    Snapshot();
+    ~Snapshot();
+    Snapshot(const Snapshot&) = delete;
+    Snapshot& operator=(const Snapshot&) = delete;
+
+    [[nodiscard]] bool empty() const { return machine_ == 0; }
+
+   private:
+    friend class GameBoy;
+
+    struct Data {
+        MachineState state;
+        Screen screen;
+        std::optional<PPU> ppu;  // Never run, points to the machine it was saved from
+        PerfCounters counters;
+        PerfCounters published_counters;
+        std::unique_ptr<Cartridge> cartridge;  // Shares the ROM of the saved one
+        uint64_t state_log_frame = 0;
+    };
+
+    std::unique_ptr<Data> data_;  // Allocated by the first save
+    uint64_t machine_ = 0;        // Instance it was saved from, 0 before the first save
+    uint32_t epoch_ = 0;          // The pages written from this epoch on differ from the snapshot
+};
+
+}  // namespace WindGB
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace WindGB {
+
+// Bounded lock-free queue for one producer thread and one consumer thread
+template <typename T, size_t Capacity>
+class SpscQueue {
+   public:
+    // Producer side, returns false without blocking when the queue is full
+    bool push(const T& value) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) return false;
+
+        slots_[tail % Capacity] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side, returns false when the queue is empty
+    bool pop(T& value) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) return false;
+
+        value = slots_[head % Capacity];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+   private:
+    std::array<T, Capacity> slots_{};
+    alignas(64) std::atomic<size_t> head_ = 0;
+    alignas(64) std::atomic<size_t> tail_ = 0;
+};
+
+}  // namespace WindGB
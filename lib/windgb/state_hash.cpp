@@ -0,0 +1,116 @@
+#include "state_hash.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace WindGB {
+
+static constexpr char STATE_LOG_MAGIC[4] = {'W', 'G', 'B', 'S'};
+static constexpr uint8_t STATE_LOG_VERSION = 1;
+
+const char* state_field_name(const StateField field) {
+    switch (field) {
+        case StateField::CPU:
+            return "CPU";
+        case StateField::BUS:
+            return "Bus";
+        case StateField::IO:
+            return "IO";
+        case StateField::WRAM:
+            return "WRAM";
+        case StateField::HRAM:
+            return "HRAM";
+        case StateField::VRAM:
+            return "VRAM";
+        case StateField::OAM:
+            return "OAM";
+        case StateField::MBC:
+            return "MBC";
+        case StateField::PPU:
+            return "PPU";
+        case StateField::TIMER:
+            return "Timer";
+        default:
+            return "Unknown";
+    }
+}
+
+static void write_u64(std::ofstream& file, const uint64_t value) {
+    char bytes[8];
+    for (int i = 0; i < 8; i++) bytes[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    file.write(bytes, 8);
+}
+
+static bool read_u64(std::ifstream& file, uint64_t& value) {
+    uint8_t bytes[8];
+    if (!file.read(reinterpret_cast<char*>(bytes), 8)) return false;
+    value = 0;
+    for (int i = 0; i < 8; i++) value |= static_cast<uint64_t>(bytes[i]) << (i * 8);
+    return true;
+}
+
+void StateHashLog::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the state log '" + path + "'");
+    }
+
+    file.write(STATE_LOG_MAGIC, 4);
+    file.put(static_cast<char>(STATE_LOG_VERSION));
+    file.put(static_cast<char>(STATE_FIELD_COUNT));
+    for (const StateHashes& entry : entries_) {
+        write_u64(file, entry.frame);
+        for (const uint64_t hash : entry.fields) write_u64(file, hash);
+    }
+}
+
+StateHashLog StateHashLog::load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary | std::ios::in);
+    if (!file) {
+        throw std::runtime_error("Unable to open the state log '" + path + "'");
+    }
+
+    char magic[4];
+    file.read(magic, 4);
+    const int version = file.get();
+    const int field_count = file.get();
+    if (!file || !std::equal(magic, magic + 4, STATE_LOG_MAGIC) || version != STATE_LOG_VERSION) {
+        throw std::runtime_error("'" + path + "' is not a WindGB state log");
+    }
+    if (static_cast<size_t>(field_count) != STATE_FIELD_COUNT) {
+        throw std::runtime_error("The state log '" + path + "' was written with other state fields");
+    }
+
+    StateHashLog log;
+    StateHashes entry;
+    while (read_u64(file, entry.frame)) {
+        for (uint64_t& hash : entry.fields) {
+            if (!read_u64(file, hash)) throw std::runtime_error("Truncated state log");
+        }
+        log.record(entry);
+    }
+    return log;
+}
+
+std::optional<StateDivergence> StateHashLog::compare(const StateHashLog& a, const StateHashLog& b) {
+    const size_t count = std::min(a.entries_.size(), b.entries_.size());
+    for (size_t i = 0; i < count; i++) {
+        const StateHashes& entry_a = a.entries_[i];
+        const StateHashes& entry_b = b.entries_[i];
+
+        StateDivergence divergence{entry_a.frame, {}};
+        for (size_t field = 0; field < STATE_FIELD_COUNT; field++) {
+            if (entry_a.fields[field] != entry_b.fields[field]) divergence.fields.push_back(static_cast<StateField>(field));
+        }
+        if (entry_a.frame != entry_b.frame || !divergence.fields.empty()) return divergence;
+    }
+
+    if (a.entries_.size() != b.entries_.size()) {
+        const auto& longer = a.entries_.size() > b.entries_.size() ? a.entries_ : b.entries_;
+        return StateDivergence{longer[count].frame, {}};
+    }
+    return std::nullopt;
+}
+
+}  // namespace WindGB
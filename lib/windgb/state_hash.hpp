@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace WindGB {
+
+enum class StateField : uint8_t {
+    CPU = 0,
+    BUS,
+    IO,
+    WRAM,
+    HRAM,
+    VRAM,
+    OAM,
+    MBC,
+    PPU,
+    TIMER,
+    COUNT,
+};
+
+constexpr size_t STATE_FIELD_COUNT = static_cast<size_t>(StateField::COUNT);
+
+[[nodiscard]] const char* state_field_name(StateField field);
+
+// Hash of each part of the machine state, taken when a frame is presented
+struct StateHashes {
+    uint64_t frame = 0;
+    std::array<uint64_t, STATE_FIELD_COUNT> fields{};
+
+    [[nodiscard]] uint64_t& operator[](StateField field) { return fields[static_cast<size_t>(field)]; }
+    [[nodiscard]] uint64_t operator[](StateField field) const { return fields[static_cast<size_t>(field)]; }
+};
+
+struct StateDivergence {
+    uint64_t frame;
+    std::vector<StateField> fields;  // Empty when one of the runs stopped earlier
+};
+
+// Per-frame state hashes of a run, saved as "WGBS", version (u8), field count (u8), then frame (u64) and field hashes (u64) per entry
+class StateHashLog {
+   public:
+    void record(const StateHashes& hashes) { entries_.push_back(hashes); }
+    [[nodiscard]] const std::vector<StateHashes>& get_entries() const { return entries_; }
+
+    void save(const std::string& path) const;
+    static StateHashLog load(const std::string& path);
+
+    // First frame where the two runs differ
+    [[nodiscard]] static std::optional<StateDivergence> compare(const StateHashLog& a, const StateHashLog& b);
+
+   private:
+    std::vector<StateHashes> entries_;
+};
+
+}  // namespace WindGB
@@ -3,65 +3,79 @@
 #include <array>
 #include <cstdint>
 
-#include "bus.hpp"
 #include "common.hpp"
-#include "io.hpp"
 #include "logger.hpp"
 
 namespace WindGB {
 
 static constexpr std::array TIMA_DIV_BIT = {9, 3, 5, 7};
 
-Timer::Timer(Bus& bus, IO& io)
-    : bus_(bus),
-      div_(io.get_data()[REG_DIV_ADDR - IO_ADDR_START]),
-      tima_(io.get_data()[REG_TIMA_ADDR - IO_ADDR_START]),
-      tma_(io.get_data()[REG_TMA_ADDR - IO_ADDR_START]),
-      tac_(io.get_data()[REG_TAC_ADDR - IO_ADDR_START]),
-      if_(io.get_data()[REG_IF_ADDR - IO_ADDR_START]) {}
-
-void Timer::init() {
-    div_16_ = 0;
+void Timer::init(const uint16_t counter) {
+    state_->timer_last_sync = state_->tick;
+    state_->div_base = state_->timer_last_sync - counter / 4;
+    div() = static_cast<uint8_t>(counter >> 8);
+    reschedule();
     LOG_INFO("Timer initialized");
 }
 
-void Timer::tick() {
-    const uint16_t div_back = div_16_;
-    div_16_++;
-    div_ = static_cast<uint8_t>(div_16_ >> 8);
+void Timer::sync() {
+    const uint64_t now = state_->tick;
+    div() = static_cast<uint8_t>(counter(now) >> 8);
 
-    if (const bool tima_enabled = tac_ & 0b100; !tima_enabled) return;
+    if (const bool tima_enabled = tac() & 0b100; tima_enabled) {
+        // TIMA is incremented on each falling edge of the selected DIV bit, i.e. each time the counter reaches a multiple of 2^(bit+1)
+        const uint8_t period_shift = TIMA_DIV_BIT[tac() & 0b11] + 1;
+        uint64_t increments = (counter(now) >> period_shift) - (counter(state_->timer_last_sync) >> period_shift);
 
-    static bool overflow = false;
-    if (overflow) {
-        static uint8_t overflow_counter = 0;
-        overflow_counter++;
-        if (overflow_counter >= 16) {
-            tima_ = tma_;
-            if_ |= (1 << 2);
-            overflow = false;
-            overflow_counter = 0;
-            return;
+        while (increments > 0) {
+            const uint32_t room = 0x100 - tima();
+            if (increments < room) {
+                tima() += increments;
+                break;
+            }
+            increments -= room;  // Overflow
+            tima() = tma();
+            interrupt_flags() |= (1 << 2);
         }
     }
 
-    const int offset = TIMA_DIV_BIT[tac_ & 0b11];
-    const bool new_bit = (div_16_ >> offset) & 1;
+    state_->timer_last_sync = now;
+    reschedule();
+}
 
-    if (const bool old_bit = (div_back >> offset) & 1; old_bit && !new_bit) {  // Detect falling edge on the corresponding bit in DIV register
-        if (tima_ >= 0xFF) {                                                   // Overflow
-            tima_ = tma_;
-            if_ |= (1 << 2);
-            // overflow = true;
-        } else {
-            tima_++;
-        }
+void Timer::write(const uint16_t addr, const uint8_t data) {
+    sync();
+    switch (addr) {
+        case REG_DIV_ADDR:  // Any write resets the internal counter
+            state_->div_base = state_->timer_last_sync;
+            div() = 0;
+            break;
+        case REG_TIMA_ADDR:
+            tima() = data;
+            break;
+        case REG_TMA_ADDR:
+            tma() = data;
+            break;
+        case REG_TAC_ADDR:
+            tac() = data;
+            break;
+        default:
+            LOG_ERROR_LIMITED("Invalid timer register 0x{:04X}", addr);
+            return;
     }
+    reschedule();
 }
 
-void Timer::reset_counter() {
-    div_16_ = 0;
-    div_ = 0;
+void Timer::reschedule() {
+    if (const bool tima_enabled = tac() & 0b100; !tima_enabled) {
+        state_->timer_next_event = MachineState::NEVER;
+        return;
+    }
+
+    const uint8_t period_shift = TIMA_DIV_BIT[tac() & 0b11] + 1;
+    const uint64_t increments_left = 0x100 - tima();
+    const uint64_t overflow_counter = ((counter(state_->timer_last_sync) >> period_shift) + increments_left) << period_shift;
+    state_->timer_next_event = state_->div_base + overflow_counter / 4;
 }
 
-}  // namespace WindGB
\ No newline at end of file
+}  // namespace WindGB
@@ -2,28 +2,41 @@
 
 #include <cstdint>
 
-namespace WindGB {
+#include "common.hpp"
+#include "hash.hpp"
+#include "machine_state.hpp"
 
-class Bus;
-class IO;
+namespace WindGB {
 
 class Timer {
    public:
-    Timer(Bus& bus, IO& io);
+    explicit Timer(MachineState& state) : state_(&state) {}
+
+    // Points the timer to the state of another machine, after a copy
+    void link(MachineState& state) { state_ = &state; }
+
+    // counter is the internal DIV counter at the current tick
+    void init(uint16_t counter = 0);
+    void sync();
+    void write(uint16_t addr, uint8_t data);
 
-    void init();
-    void tick();
-    void reset_counter();
+    // Bus tick at which TIMA will overflow, the bus syncs the timer when it is reached
+    [[nodiscard]] uint64_t next_event() const { return state_->timer_next_event; }
+
+    // Only meaningful right after a sync
+    [[nodiscard]] uint64_t hash_state() const { return hash_combine(counter(state_->timer_last_sync), state_->timer_last_sync); }
 
    private:
-    Bus& bus_;
-
-    uint16_t div_16_ = 0;
-    uint8_t& div_;
-    uint8_t& tima_;
-    uint8_t& tma_;
-    uint8_t& tac_;
-    uint8_t& if_;
+    MachineState* state_;
+
+    uint8_t& div() const { return state_->io[REG_DIV_ADDR - IO_ADDR_START]; }
+    uint8_t& tima() const { return state_->io[REG_TIMA_ADDR - IO_ADDR_START]; }
+    uint8_t& tma() const { return state_->io[REG_TMA_ADDR - IO_ADDR_START]; }
+    uint8_t& tac() const { return state_->io[REG_TAC_ADDR - IO_ADDR_START]; }
+    uint8_t& interrupt_flags() const { return state_->io[REG_IF_ADDR - IO_ADDR_START]; }
+
+    [[nodiscard]] uint64_t counter(uint64_t tick) const { return (tick - state_->div_base) * 4; }  // Internal 16 bits DIV counter, not wrapped
+    void reschedule();
 };
 
-}  // namespace WindGB
\ No newline at end of file
+}  // namespace WindGB
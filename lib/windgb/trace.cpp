@@ -0,0 +1,117 @@
+#include "trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "logger.hpp"
+
+namespace WindGB {
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+};
+
+// Written by its thread only, read when the trace is exported
+struct ThreadBuffer {
+    static constexpr size_t CAPACITY = 1 << 18;  // The oldest slices are overwritten past it
+
+    uint32_t tid = 0;
+    std::string name;  // Guarded by registry_mutex
+    std::unique_ptr<TraceEvent[]> events = std::make_unique<TraceEvent[]>(CAPACITY);
+    std::atomic<uint64_t> count = 0;
+};
+
+static std::mutex registry_mutex;
+static std::vector<std::shared_ptr<ThreadBuffer>> registry;  // Kept after their thread exits
+static uint64_t start_time = 0;
+static thread_local ThreadBuffer* thread_buffer = nullptr;
+static thread_local std::string thread_name;  // Until the thread records its first slice
+
+static ThreadBuffer& get_thread_buffer() {
+    if (!thread_buffer) {
+        const std::lock_guard lock(registry_mutex);
+        auto buffer = std::make_shared<ThreadBuffer>();
+        buffer->tid = static_cast<uint32_t>(registry.size() + 1);
+        buffer->name = thread_name.empty() ? "Thread " + std::to_string(buffer->tid) : thread_name;
+        thread_buffer = buffer.get();
+        registry.push_back(std::move(buffer));
+    }
+    return *thread_buffer;
+}
+
+void Tracer::start() {
+    start_time = now();
+    enabled_.store(true, std::memory_order_release);
+}
+
+void Tracer::stop() { enabled_.store(false, std::memory_order_release); }
+
+uint64_t Tracer::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+void Tracer::record(const char* name, const uint64_t start, const uint64_t end) {
+    ThreadBuffer& buffer = get_thread_buffer();
+    const uint64_t count = buffer.count.load(std::memory_order_relaxed);
+    buffer.events[count % ThreadBuffer::CAPACITY] = {name, start, end};
+    buffer.count.store(count + 1, std::memory_order_release);
+}
+
+void Tracer::set_thread_name(const std::string& name) {
+    thread_name = name;
+    if (thread_buffer) {
+        const std::lock_guard lock(registry_mutex);
+        thread_buffer->name = name;
+    }
+}
+
+static std::string escape_json(const std::string& text) {
+    std::string out;
+    for (const char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+void Tracer::write_chrome_json(const std::string& path) {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open the trace file '" + path + "'");
+    }
+
+    const std::lock_guard lock(registry_mutex);
+    size_t written = 0;
+    char line[256];
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"WindGB\"}}";
+    for (const auto& buffer : registry) {
+        file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->tid << ",\"args\":{\"name\":\"" << escape_json(buffer->name)
+             << "\"}}";
+
+        const uint64_t count = buffer->count.load(std::memory_order_acquire);
+        for (uint64_t i = count - std::min<uint64_t>(count, ThreadBuffer::CAPACITY); i < count; i++) {
+            const TraceEvent& event = buffer->events[i % ThreadBuffer::CAPACITY];
+            if (event.start < start_time) continue;
+
+            // Microseconds since start
+            std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", event.name, buffer->tid,
+                          static_cast<double>(event.start - start_time) / 1000.0, static_cast<double>(event.end - event.start) / 1000.0);
+            file << line;
+            written++;
+        }
+    }
+    file << "\n]}\n";
+
+    LOG_INFO("{} trace events written into '{}'", written, path);
+}
+
+}  // namespace WindGB
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace WindGB {
+
+// Host side timeline of the emulator threads, written in the Chrome trace event format (ui.perfetto.dev, chrome://tracing).
+// Every thread records into its own ring buffer without locking, only the first event of a thread registers its buffer.
+// Recording is off until start, a disabled TRACE_SCOPE costs one relaxed load.
+class Tracer {
+   public:
+    static void start();
+    static void stop();
+    [[nodiscard]] static bool is_enabled() { return enabled_.load(std::memory_order_relaxed); }
+
+    // Nanoseconds of the steady clock
+    [[nodiscard]] static uint64_t now();
+    // Adds a slice to the buffer of the calling thread. The name must outlive the tracer, a string literal in practice.
+    static void record(const char* name, uint64_t start, uint64_t end);
+    // Name of the calling thread in the timeline
+    static void set_thread_name(const std::string& name);
+
+    // Writes the slices of every thread, to be called once the traced threads are stopped
+    static void write_chrome_json(const std::string& path);
+
+   private:
+    static inline std::atomic<bool> enabled_ = false;
+};
+
+// Records the lifetime of the scope as a slice when the tracer is enabled at its construction
+class TraceScope {
+   public:
+    explicit TraceScope(const char* name) : name_(name), start_(Tracer::is_enabled() ? Tracer::now() : 0) {}
+    ~TraceScope() {
+        if (start_) Tracer::record(name_, start_, Tracer::now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+   private:
+    const char* name_;
+    uint64_t start_;
+};
+
+}  // namespace WindGB
+
+#define WINDGB_TRACE_CONCAT_(a, b) a##b
+#define WINDGB_TRACE_CONCAT(a, b) WINDGB_TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) const ::WindGB::TraceScope WINDGB_TRACE_CONCAT(trace_scope_, __LINE__)(name)
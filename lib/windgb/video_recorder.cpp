@@ -0,0 +1,336 @@
+#include "video_recorder.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <stdexcept>
+#include <utility>
+
+#include "logger.hpp"
+#include "trace.hpp"
+
+namespace WindGB {
+
+static constexpr char STREAM_MAGIC[4] = {'W', 'G', 'B', 'V'};
+static constexpr uint8_t STREAM_VERSION = 1;
+static constexpr uint8_t CHANGED_LINE = 0x80;
+
+static void put_u16(std::vector<uint8_t>& out, const uint16_t value) {
+    out.push_back(value & 0xFF);
+    out.push_back(value >> 8);
+}
+
+static void put_u32(std::vector<uint8_t>& out, const uint32_t value) {
+    for (int i = 0; i < 4; i++) out.push_back((value >> (i * 8)) & 0xFF);
+}
+
+static void put_u32_be(std::vector<uint8_t>& out, const uint32_t value) {
+    for (int i = 3; i >= 0; i--) out.push_back((value >> (i * 8)) & 0xFF);
+}
+
+static uint32_t read_u32(std::ifstream& file) {
+    uint8_t bytes[4];
+    file.read(reinterpret_cast<char*>(bytes), 4);
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+static void write_bytes(std::ofstream& file, const std::vector<uint8_t>& bytes) {
+    file.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+}
+
+VideoRecorder::VideoRecorder(const std::string& path, const Palette& palette)
+    : file_(path, std::ios::binary | std::ios::out | std::ios::trunc), queue_(std::make_unique<SpscQueue<QueuedFrame, QUEUE_CAPACITY>>()) {
+    if (!file_) {
+        throw std::runtime_error("Unable to open the video stream '" + path + "'");
+    }
+
+    std::vector<uint8_t> header(STREAM_MAGIC, STREAM_MAGIC + 4);
+    header.push_back(STREAM_VERSION);
+    put_u16(header, SCREEN_WIDTH);
+    put_u16(header, SCREEN_HEIGHT);
+    for (const uint32_t color : palette) put_u32(header, color);
+    write_bytes(file_, header);
+
+    worker_ = std::thread(&VideoRecorder::run_worker, this);
+}
+
+VideoRecorder::~VideoRecorder() { stop(); }
+
+void VideoRecorder::push_frame(const uint8_t* shades) {
+    QueuedFrame frame;
+    frame.number = presented_frames_++;
+    std::copy_n(shades, frame.shades.size(), frame.shades.begin());
+
+    if (!queue_->push(frame)) {
+        dropped_frames_++;
+        return;
+    }
+    wake_.fetch_add(1, std::memory_order_release);
+    wake_.notify_one();
+}
+
+void VideoRecorder::stop() {
+    if (!worker_.joinable()) return;
+
+    stopping_ = true;
+    wake_.fetch_add(1, std::memory_order_release);
+    wake_.notify_one();
+    worker_.join();
+    file_.close();
+
+    LOG_INFO("Video recording stopped: {} frames recorded, {} dropped", recorded_frames_.load(), dropped_frames_.load());
+}
+
+void VideoRecorder::run_worker() {
+    Tracer::set_thread_name("Video encoder");
+    auto frame = std::make_unique<QueuedFrame>();
+    while (true) {
+        // Read the wake counter first so a push or a stop happening after the checks below ends the wait
+        const uint32_t wake = wake_.load(std::memory_order_acquire);
+        if (queue_->pop(*frame)) {
+            encode_frame(*frame);
+            continue;
+        }
+        if (stopping_) break;
+        wake_.wait(wake, std::memory_order_acquire);
+    }
+}
+
+void VideoRecorder::encode_frame(const QueuedFrame& frame) {
+    TRACE_SCOPE("Encode frame");
+    encoded_.clear();
+    put_u32(encoded_, frame.number);
+
+    uint8_t unchanged_lines = 0;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        const uint8_t* line = frame.shades.data() + y * SCREEN_WIDTH;
+        uint8_t* previous_line = previous_.data() + y * SCREEN_WIDTH;
+
+        // The first frame is coded against a blank frame
+        if (std::equal(line, line + SCREEN_WIDTH, previous_line)) {
+            if (++unchanged_lines == 128) {
+                encoded_.push_back(unchanged_lines - 1);
+                unchanged_lines = 0;
+            }
+            continue;
+        }
+        if (unchanged_lines > 0) {
+            encoded_.push_back(unchanged_lines - 1);
+            unchanged_lines = 0;
+        }
+
+        encoded_.push_back(CHANGED_LINE);
+        for (int x = 0; x < SCREEN_WIDTH;) {
+            int run = 1;
+            while (x + run < SCREEN_WIDTH && run < 64 && line[x + run] == line[x]) run++;
+            encoded_.push_back((line[x] << 6) | (run - 1));
+            x += run;
+        }
+        std::copy_n(line, SCREEN_WIDTH, previous_line);
+    }
+    if (unchanged_lines > 0) {
+        encoded_.push_back(unchanged_lines - 1);
+    }
+
+    write_bytes(file_, encoded_);
+    recorded_frames_++;
+}
+
+VideoStreamReader::VideoStreamReader(const std::string& path) : file_(path, std::ios::binary | std::ios::in) {
+    if (!file_) {
+        throw std::runtime_error("Unable to open the video stream '" + path + "'");
+    }
+
+    char magic[4];
+    file_.read(magic, 4);
+    const int version = file_.get();
+    uint8_t size[4];
+    file_.read(reinterpret_cast<char*>(size), 4);
+    if (!file_ || !std::equal(magic, magic + 4, STREAM_MAGIC) || version != STREAM_VERSION) {
+        throw std::runtime_error("'" + path + "' is not a WindGB video stream");
+    }
+    if ((size[0] | (size[1] << 8)) != SCREEN_WIDTH || (size[2] | (size[3] << 8)) != SCREEN_HEIGHT) {
+        throw std::runtime_error("Unsupported video stream size");
+    }
+    for (uint32_t& color : palette_) color = read_u32(file_);
+}
+
+bool VideoStreamReader::next_frame(ShadeFrame& frame, uint32_t& number) {
+    number = read_u32(file_);
+    if (!file_) return false;
+
+    int y = 0;
+    while (y < SCREEN_HEIGHT) {
+        const int tag = file_.get();
+        if (tag == EOF) throw std::runtime_error("Truncated video stream");
+
+        if (tag != CHANGED_LINE) {
+            y += tag + 1;
+            continue;
+        }
+
+        uint8_t* line = previous_.data() + y * SCREEN_WIDTH;
+        for (int x = 0; x < SCREEN_WIDTH;) {
+            const int run = file_.get();
+            if (run == EOF) throw std::runtime_error("Truncated video stream");
+            const int length = std::min((run & 0x3F) + 1, SCREEN_WIDTH - x);
+            std::fill_n(line + x, length, run >> 6);
+            x += length;
+        }
+        y++;
+    }
+
+    frame = previous_;
+    return true;
+}
+
+void export_y4m(const std::string& stream_path, const std::string& output_path) {
+    VideoStreamReader reader(stream_path);
+    std::ofstream file(output_path, std::ios::binary | std::ios::out | std::ios::trunc);
+    if (!file) {
+        throw std::runtime_error("Unable to open '" + output_path + "'");
+    }
+
+    // Full range BT.601 (JPEG) conversion of the palette
+    uint8_t luma[4], cb[4], cr[4];
+    for (int shade = 0; shade < 4; shade++) {
+        const uint32_t color = reader.get_palette()[shade];
+        const double r = color & 0xFF, g = (color >> 8) & 0xFF, b = (color >> 16) & 0xFF;
+        luma[shade] = static_cast<uint8_t>(std::clamp(0.299 * r + 0.587 * g + 0.114 * b, 0.0, 255.0));
+        cb[shade] = static_cast<uint8_t>(std::clamp(128 - 0.168736 * r - 0.331264 * g + 0.5 * b, 0.0, 255.0));
+        cr[shade] = static_cast<uint8_t>(std::clamp(128 + 0.5 * r - 0.418688 * g - 0.081312 * b, 0.0, 255.0));
+    }
+
+    const std::string header = "YUV4MPEG2 W" + std::to_string(SCREEN_WIDTH) + " H" + std::to_string(SCREEN_HEIGHT) + " F4194304:70224 Ip A1:1 C420jpeg\n";
+    file << header;
+
+    std::vector<uint8_t> planes;
+    std::vector<uint8_t> previous_planes;  // Last frame written
+    planes.reserve(SCREEN_WIDTH * SCREEN_HEIGHT * 3 / 2);
+
+    ShadeFrame frame;
+    uint32_t number;
+    int64_t next_number = -1;
+    uint64_t frames = 0;
+    while (reader.next_frame(frame, number)) {
+        planes.clear();
+        for (const uint8_t shade : frame) planes.push_back(luma[shade]);
+        for (const uint8_t* chroma : {cb, cr}) {
+            for (int y = 0; y < SCREEN_HEIGHT; y += 2) {
+                for (int x = 0; x < SCREEN_WIDTH; x += 2) {
+                    const int i = y * SCREEN_WIDTH + x;
+                    const int sum = chroma[frame[i]] + chroma[frame[i + 1]] + chroma[frame[i + SCREEN_WIDTH]] + chroma[frame[i + SCREEN_WIDTH + 1]];
+                    planes.push_back(static_cast<uint8_t>((sum + 2) / 4));
+                }
+            }
+        }
+
+        // Repeat the previous frame in place of the dropped ones so the video keeps the emulated timing
+        const int64_t dropped = next_number < 0 ? 0 : std::max<int64_t>(0, number - next_number);
+        for (int64_t i = 0; i < dropped; i++) {
+            file << "FRAME\n";
+            write_bytes(file, previous_planes);
+            frames++;
+        }
+        file << "FRAME\n";
+        write_bytes(file, planes);
+        frames++;
+        next_number = static_cast<int64_t>(number) + 1;
+        std::swap(planes, previous_planes);
+    }
+
+    LOG_INFO("Exported {} frames to {}", frames, output_path);
+}
+
+static uint32_t crc32(const uint8_t* data, const size_t size, uint32_t crc = 0) {
+    static const auto TABLE = [] {
+        std::array<uint32_t, 256> table{};
+        for (uint32_t n = 0; n < 256; n++) {
+            uint32_t c = n;
+            for (int k = 0; k < 8; k++) c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+            table[n] = c;
+        }
+        return table;
+    }();
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) crc = TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void put_png_chunk(std::vector<uint8_t>& out, const char* type, const std::vector<uint8_t>& data) {
+    put_u32_be(out, data.size());
+    const size_t start = out.size();
+    out.insert(out.end(), type, type + 4);
+    out.insert(out.end(), data.begin(), data.end());
+    put_u32_be(out, crc32(out.data() + start, out.size() - start));
+}
+
+// 8 bits indexed PNG, the image data is stored in uncompressed deflate blocks
+static std::vector<uint8_t> encode_png(const ShadeFrame& frame, const Palette& palette) {
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+    std::vector<uint8_t> ihdr;
+    put_u32_be(ihdr, SCREEN_WIDTH);
+    put_u32_be(ihdr, SCREEN_HEIGHT);
+    ihdr.insert(ihdr.end(), {8, 3, 0, 0, 0});  // Depth, indexed color, deflate, no filter, no interlace
+    put_png_chunk(png, "IHDR", ihdr);
+
+    std::vector<uint8_t> plte;
+    for (const uint32_t color : palette) {
+        plte.push_back(static_cast<uint8_t>(color));
+        plte.push_back(static_cast<uint8_t>(color >> 8));
+        plte.push_back(static_cast<uint8_t>(color >> 16));
+    }
+    put_png_chunk(png, "PLTE", plte);
+
+    std::vector<uint8_t> raw;
+    for (int y = 0; y < SCREEN_HEIGHT; y++) {
+        raw.push_back(0);  // No filter
+        raw.insert(raw.end(), frame.begin() + y * SCREEN_WIDTH, frame.begin() + (y + 1) * SCREEN_WIDTH);
+    }
+
+    std::vector<uint8_t> idat = {0x78, 0x01};
+    uint32_t adler_a = 1, adler_b = 0;
+    for (const uint8_t byte : raw) {
+        adler_a = (adler_a + byte) % 65521;
+        adler_b = (adler_b + adler_a) % 65521;
+    }
+    for (size_t offset = 0; offset < raw.size(); offset += 65535) {
+        const uint16_t length = std::min<size_t>(65535, raw.size() - offset);
+        idat.push_back(offset + length == raw.size() ? 1 : 0);  // Final block flag
+        put_u16(idat, length);
+        put_u16(idat, ~length);
+        idat.insert(idat.end(), raw.begin() + offset, raw.begin() + offset + length);
+    }
+    put_u32_be(idat, (adler_b << 16) | adler_a);
+    put_png_chunk(png, "IDAT", idat);
+
+    put_png_chunk(png, "IEND", {});
+    return png;
+}
+
+void export_png_sequence(const std::string& stream_path, const std::string& output_dir) {
+    VideoStreamReader reader(stream_path);
+    std::filesystem::create_directories(output_dir);
+
+    ShadeFrame frame;
+    uint32_t number;
+    uint64_t frames = 0;
+    while (reader.next_frame(frame, number)) {
+        char name[32];
+        std::snprintf(name, sizeof(name), "frame_%06u.png", number);
+        const std::string path = (std::filesystem::path(output_dir) / name).string();
+
+        std::ofstream file(path, std::ios::binary | std::ios::out | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Unable to open '" + path + "'");
+        }
+        write_bytes(file, encode_png(frame, reader.get_palette()));
+        frames++;
+    }
+
+    LOG_INFO("Exported {} frames to {}", frames, output_dir);
+}
+
+}  // namespace WindGB
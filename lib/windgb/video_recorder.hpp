@@ -0,0 +1,85 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common.hpp"
+#include "ppu.hpp"
+#include "spsc_queue.hpp"
+
+namespace WindGB {
+
+// Stream layout (little endian):
+//  header: "WGBV", version (u8), width (u16), height (u16), palette (4 x u32 RGBA)
+//  frame:  presented frame number (u32), then lines coded against the same lines of the previous frame
+//          0x00-0x7F: the next n + 1 lines are unchanged
+//          0x80: a changed line follows as runs, one byte per run: shade << 6 | (length - 1)
+using ShadeFrame = std::array<uint8_t, SCREEN_WIDTH * SCREEN_HEIGHT>;
+
+// Records the presented frames on a worker thread, the emulation thread only copies the frame into a queue
+class VideoRecorder {
+   public:
+    static constexpr size_t QUEUE_CAPACITY = 64;
+
+    VideoRecorder(const std::string& path, const Palette& palette);
+    ~VideoRecorder();
+
+    // Emulation thread, the frame is dropped when the worker is too far behind
+    void push_frame(const uint8_t* shades);
+    // Encodes the queued frames and closes the stream
+    void stop();
+
+    [[nodiscard]] uint64_t get_recorded_frames() const { return recorded_frames_.load(); }
+    [[nodiscard]] uint64_t get_dropped_frames() const { return dropped_frames_.load(); }
+
+   private:
+    struct QueuedFrame {
+        uint32_t number;
+        ShadeFrame shades;
+    };
+
+    std::ofstream file_;
+    std::unique_ptr<SpscQueue<QueuedFrame, QUEUE_CAPACITY>> queue_;
+    uint32_t presented_frames_ = 0;
+    std::atomic<uint64_t> recorded_frames_ = 0;
+    std::atomic<uint64_t> dropped_frames_ = 0;
+
+    // Worker
+    std::thread worker_;
+    std::atomic<uint32_t> wake_ = 0;
+    std::atomic<bool> stopping_ = false;
+    ShadeFrame previous_{};
+    std::vector<uint8_t> encoded_;
+
+    void run_worker();
+    void encode_frame(const QueuedFrame& frame);
+};
+
+// Decodes a recorded stream frame by frame
+class VideoStreamReader {
+   public:
+    explicit VideoStreamReader(const std::string& path);
+
+    // Returns false at the end of the stream
+    bool next_frame(ShadeFrame& frame, uint32_t& number);
+
+    [[nodiscard]] const Palette& get_palette() const { return palette_; }
+
+   private:
+    std::ifstream file_;
+    Palette palette_{};
+    ShadeFrame previous_{};
+};
+
+// Writes the stream as a YUV4MPEG2 video, dropped frames are filled with the previous one
+void export_y4m(const std::string& stream_path, const std::string& output_path);
+// Writes every frame of the stream as frame_<number>.png in the output directory
+void export_png_sequence(const std::string& stream_path, const std::string& output_dir);
+
+}  // namespace WindGB
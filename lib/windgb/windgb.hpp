@@ -1,5 +1,19 @@
 #pragma once
 
+#include "boot_rom.hpp"
 #include "cartridge.hpp"
+#include "flight_recorder.hpp"
 #include "gameboy.hpp"
+#include "hardware_counters.hpp"
+#include "input_script.hpp"
 #include "logger.hpp"
+#include "memory_stats.hpp"
+#include "movie.hpp"
+#include "perf_counters.hpp"
+#include "profiler.hpp"
+#include "seqlock.hpp"
+#include "snapshot.hpp"
+#include "spsc_queue.hpp"
+#include "state_hash.hpp"
+#include "trace.hpp"
+#include "video_recorder.hpp"
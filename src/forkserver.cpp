@@ -0,0 +1,277 @@
+#include <poll.h>
+#include <spdlog/sinks/null_sink.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <argparse/argparse.hpp>
+#include <csignal>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "windgb.hpp"
+
+struct ServerOptions {
+    std::string rom_path;
+    std::string socket_path;
+    std::string movie_path;
+    std::string boot_rom_path;
+    uint64_t frames = 0;
+    bool skip_boot = false;
+    size_t max_jobs = 0;
+};
+
+// Job run by a child, which writes its results into the pipe. The server forwards them to the client once the child
+// closed it, and reports the jobs whose child died without a result.
+struct Job {
+    pid_t pid;
+    int client;
+    int result;
+    std::string output;
+};
+
+static volatile std::sig_atomic_t g_stop = 0;
+
+static void request_stop(int) { g_stop = 1; }
+
+static std::runtime_error system_error(const std::string& what) { return std::runtime_error(what + ": " + std::strerror(errno)); }
+
+static bool write_all(const int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+        const ssize_t count = write(fd, data.data() + written, data.size() - written);
+        if (count < 0 && errno == EINTR) continue;
+        if (count <= 0) return false;
+        written += count;
+    }
+    return true;
+}
+
+// Reads until the peer closes or shuts down its side
+static std::string read_all(const int fd) {
+    std::string data;
+    char buffer[4096];
+    ssize_t count;
+    while ((count = read(fd, buffer, sizeof(buffer))) != 0) {
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        data.append(buffer, count);
+    }
+    return data;
+}
+
+// Loads the ROM and runs the movie, then the frames, to reach the state every job starts from
+static void warm_up(WindGB::GameBoy& gameboy, WindGB::Cartridge& cart, const ServerOptions& options, const WindGB::PPU::Engine engine) {
+    std::unique_ptr<WindGB::MovieReader> movie;
+    WindGB::BootMode boot_mode = options.skip_boot ? WindGB::BootMode::SKIP : WindGB::BootMode::BOOT_ROM;
+    if (!options.movie_path.empty()) {
+        movie = std::make_unique<WindGB::MovieReader>(options.movie_path);
+        boot_mode = movie->get_start();
+    }
+
+    cart.load(options.rom_path);
+    gameboy.insert(&cart);
+    if (!options.boot_rom_path.empty()) {
+        gameboy.set_boot_rom(WindGB::load_boot_rom(options.boot_rom_path));
+    }
+    gameboy.init(boot_mode);
+    gameboy.get_ppu().set_engine(engine);
+
+    if (movie) {
+        const WindGB::MoviePlaybackResult playback = WindGB::play_movie(gameboy, *movie);
+        if (playback.mismatch_frame) {
+            throw std::runtime_error("Checkpoint mismatch at frame " + std::to_string(*playback.mismatch_frame) + " of the warm-up movie");
+        }
+    }
+    const uint64_t frames = options.frames > gameboy.get_ppu().get_frame_count() ? options.frames - gameboy.get_ppu().get_frame_count() : 0;
+    WindGB::run_input_script(gameboy, {{frames, 0}});
+}
+
+// Runs in the child: reads the input script sent by the client, plays it from the inherited state and writes the results
+static int run_job(WindGB::GameBoy& gameboy, const int client, const int result) {
+    // The background thread of the default logger does not exist in the child
+    const auto logger = std::make_shared<spdlog::logger>("job", std::make_shared<spdlog::sinks::null_sink_mt>());
+    WindGB::Logger::Scope scope(logger.get());
+
+    std::ostringstream output;
+    int status = EXIT_SUCCESS;
+    try {
+        std::istringstream script(read_all(client));
+        const uint64_t frames = WindGB::run_input_script(gameboy, WindGB::parse_input_script(script));
+
+        const WindGB::StateHashes hashes = gameboy.hash_state();
+        output << "frames " << frames << "\n";
+        output << "frame " << hashes.frame << "\n";
+        output << std::hex << "frame_hash " << gameboy.get_frame_hash() << "\n";
+        for (size_t i = 0; i < WindGB::STATE_FIELD_COUNT; i++) {
+            output << WindGB::state_field_name(static_cast<WindGB::StateField>(i)) << " " << hashes.fields[i] << "\n";
+        }
+    } catch (const std::exception& e) {
+        output << "error " << e.what() << "\n";
+        status = EXIT_FAILURE;
+    }
+    return write_all(result, output.str()) ? status : EXIT_FAILURE;
+}
+
+static int listen_on(const std::string& path) {
+    sockaddr_un address{};
+    if (path.size() >= sizeof(address.sun_path)) {
+        throw std::runtime_error("The socket path '" + path + "' is too long");
+    }
+    address.sun_family = AF_UNIX;
+    std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+    const int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) throw system_error("Unable to create the socket");
+    unlink(path.c_str());
+    if (bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) throw system_error("Unable to bind '" + path + "'");
+    if (listen(fd, SOMAXCONN) < 0) throw system_error("Unable to listen on '" + path + "'");
+    return fd;
+}
+
+static void start_job(WindGB::GameBoy& gameboy, const int server, const int client, std::vector<Job>& jobs) {
+    int fds[2];
+    if (pipe(fds) < 0) {
+        std::cerr << "Job rejected, " << std::strerror(errno) << std::endl;
+        close(client);
+        return;
+    }
+
+    const pid_t pid = fork();
+    if (pid == 0) {
+        std::signal(SIGINT, SIG_DFL);
+        std::signal(SIGTERM, SIG_DFL);
+        // Only the client and the result pipe stay open, the other clients see the end of their results when the server closes them
+        close(server);
+        close(fds[0]);
+        for (const Job& job : jobs) {
+            close(job.client);
+            close(job.result);
+        }
+        const int status = run_job(gameboy, client, fds[1]);
+        // Skips the destructors and exit handlers of the server state
+        _exit(status);
+    }
+
+    close(fds[1]);
+    if (pid < 0) {
+        std::cerr << "Job rejected, " << std::strerror(errno) << std::endl;
+        close(fds[0]);
+        close(client);
+        return;
+    }
+    jobs.push_back({pid, client, fds[0], {}});
+}
+
+// Forwards the results to the client and reaps the child
+static void finish_job(Job& job) {
+    int status = 0;
+    waitpid(job.pid, &status, 0);
+    if (job.output.empty()) {
+        job.output = WIFSIGNALED(status) ? "error job killed by signal " + std::to_string(WTERMSIG(status)) + "\n" : "error job ended without result\n";
+    }
+    write_all(job.client, job.output);
+    close(job.client);
+    close(job.result);
+}
+
+static void serve(WindGB::GameBoy& gameboy, const int server, const size_t max_jobs) {
+    std::vector<Job> jobs;
+    std::vector<pollfd> fds;
+    while (!g_stop) {
+        // New connections wait in the backlog while every job slot is busy
+        const bool accepting = jobs.size() < max_jobs;
+        fds.clear();
+        for (const Job& job : jobs) fds.push_back({job.result, POLLIN, 0});
+        if (accepting) fds.push_back({server, POLLIN, 0});
+
+        if (poll(fds.data(), fds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            throw system_error("Unable to wait for the jobs");
+        }
+
+        for (size_t i = jobs.size(); i-- > 0;) {
+            if (!fds[i].revents) continue;
+            char buffer[4096];
+            const ssize_t count = read(jobs[i].result, buffer, sizeof(buffer));
+            if (count > 0) {
+                jobs[i].output.append(buffer, count);
+            } else if (count == 0 || errno != EINTR) {
+                finish_job(jobs[i]);
+                jobs.erase(jobs.begin() + static_cast<std::ptrdiff_t>(i));
+            }
+        }
+
+        if (accepting && fds.back().revents & POLLIN) {
+            const int client = accept4(server, nullptr, nullptr, SOCK_CLOEXEC);
+            if (client >= 0) start_job(gameboy, server, client, jobs);
+        }
+    }
+
+    for (Job& job : jobs) finish_job(job);
+}
+
+// Warms a machine up once, then forks it for every job received on a Unix domain socket. The children share the warm
+// state with the server copy-on-write, and only duplicate the pages they write.
+int main(int argc, char** argv) {
+    ServerOptions options;
+    std::string ppu_engine;
+
+    argparse::ArgumentParser parser("windgb_forkserver", "0.1.0");
+    parser.add_argument("rom_path").help("Path to the ROM to load into the emulator.").store_into(options.rom_path);
+    parser.add_argument("--socket").help("Unix domain socket to accept the jobs on.").required().store_into(options.socket_path);
+    parser.add_argument("--frames")
+        .help("Frame the machine runs to, without inputs, before accepting jobs.")
+        .default_value(uint64_t{0})
+        .scan<'u', uint64_t>()
+        .store_into(options.frames);
+    parser.add_argument("--movie").help("Replay a movie to reach the state the jobs start from, before --frames.").store_into(options.movie_path);
+    parser.add_argument("--boot-rom").help("Boot ROM to run instead of the embedded one.").store_into(options.boot_rom_path);
+    parser.add_argument("--skip-boot")
+        .help("Start at the cartridge entry point in the post-boot state. Movies start the way they were recorded.")
+        .flag()
+        .store_into(options.skip_boot);
+    parser.add_argument("--ppu").help("PPU engine, 'scanline' or 'fifo'.").default_value(std::string("scanline")).choices("scanline", "fifo").store_into(ppu_engine);
+    parser.add_argument("--max-jobs")
+        .help("Jobs running at once, the number of hardware threads by default.")
+        .default_value(size_t{std::max(1u, std::thread::hardware_concurrency())})
+        .scan<'u', size_t>()
+        .store_into(options.max_jobs);
+
+    try {
+        parser.parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        std::cerr << parser;
+        exit(EXIT_FAILURE);
+    }
+
+    WindGB::Logger::init();
+
+    WindGB::Cartridge cart;
+    const auto gameboy = std::make_unique<WindGB::GameBoy>();
+    warm_up(*gameboy, cart, options, ppu_engine == "fifo" ? WindGB::PPU::Engine::FIFO : WindGB::PPU::Engine::SCANLINE);
+    WindGB::Logger::flush();
+
+    const int server = listen_on(options.socket_path);
+    std::signal(SIGPIPE, SIG_IGN);  // Clients may leave before their results
+    std::signal(SIGINT, request_stop);
+    std::signal(SIGTERM, request_stop);
+    std::cout << "Warm state at frame " << gameboy->get_ppu().get_frame_count() << ", accepting jobs on " << options.socket_path << std::endl;
+
+    serve(*gameboy, server, std::max<size_t>(options.max_jobs, 1));
+
+    close(server);
+    unlink(options.socket_path.c_str());
+    return EXIT_SUCCESS;
+}
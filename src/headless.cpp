@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <argparse/argparse.hpp>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "windgb.hpp"
+
+struct RunResult {
+    uint64_t frames = 0;
+    uint64_t ticks = 0;
+    uint64_t frame_hash = 0;
+    bool checkpoint_mismatch = false;
+    WindGB::PerfCounters counters;
+};
+
+// Writes <prefix>.csv, <prefix>.json and the <prefix>.ppm heatmap
+void write_memory_stats([[maybe_unused]] const WindGB::GameBoy& gameboy, const std::string& prefix) {
+#ifdef WINDGB_MEMORY_STATS
+    const WindGB::MemoryStats& stats = gameboy.get_memory_stats();
+    stats.write_csv(prefix + ".csv");
+    stats.write_json(prefix + ".json");
+    stats.write_heatmap(prefix + ".ppm");
+#else
+    std::cerr << "Memory statistics of '" << prefix << "' not written, WindGB is built without WINDGB_MEMORY_STATS" << std::endl;
+#endif
+}
+
+WindGB::PPU::Engine parse_ppu_engine(const std::string& name) { return name == "fifo" ? WindGB::PPU::Engine::FIFO : WindGB::PPU::Engine::SCANLINE; }
+
+struct RunOptions {
+    std::string rom_path;
+    std::string movie_path;
+    uint64_t frames = 0;
+    std::string boot_rom_path;
+    bool skip_boot = false;  // Overridden by the boot mode of the movie
+};
+
+// Runs the movie, or the given number of frames without inputs, and records the state hashes into the log and the profile when given.
+// The hardware counters only measure the emulation loop.
+RunResult run(const RunOptions& options, const WindGB::PPU::Engine engine, WindGB::StateHashLog* state_log, WindGB::Profiler* profiler = nullptr,
+              const std::string& memory_stats_prefix = "", WindGB::HardwareCounters* hardware_counters = nullptr) {
+    WindGB::Cartridge cart;
+    WindGB::GameBoy gameboy;
+
+    std::unique_ptr<WindGB::MovieReader> movie;
+    WindGB::BootMode boot_mode = options.skip_boot ? WindGB::BootMode::SKIP : WindGB::BootMode::BOOT_ROM;
+    if (!options.movie_path.empty()) {
+        movie = std::make_unique<WindGB::MovieReader>(options.movie_path);
+        boot_mode = movie->get_start();
+    }
+
+    cart.load(options.rom_path);
+    gameboy.insert(&cart);
+    if (!options.boot_rom_path.empty()) {
+        gameboy.set_boot_rom(WindGB::load_boot_rom(options.boot_rom_path));
+    }
+    gameboy.init(boot_mode);
+    gameboy.get_ppu().set_engine(engine);
+    gameboy.set_state_log(state_log);
+    gameboy.set_profiler(profiler);
+
+    RunResult result;
+    if (hardware_counters) hardware_counters->start();
+    if (movie) {
+        const WindGB::MoviePlaybackResult playback = WindGB::play_movie(gameboy, *movie);
+
+        if (playback.mismatch_frame) {
+            std::cout << "Checkpoint mismatch at frame " << *playback.mismatch_frame << std::endl;
+            result.checkpoint_mismatch = true;
+        } else {
+            std::cout << playback.checkpoints << " checkpoints matched" << std::endl;
+        }
+    } else {
+        const WindGB::GameBoy::Session session(gameboy);
+        while (gameboy.get_ppu().get_frame_count() < options.frames) {
+            gameboy.step();
+        }
+    }
+    if (hardware_counters) hardware_counters->stop();
+
+    result.frames = gameboy.get_ppu().get_frame_count();
+    result.ticks = gameboy.get_tick();
+    result.frame_hash = gameboy.get_frame_hash();
+    result.counters = gameboy.get_counters();
+    if (!memory_stats_prefix.empty()) {
+        write_memory_stats(gameboy, memory_stats_prefix);
+    }
+    return result;
+}
+
+bool report_divergence(const WindGB::StateHashLog& a, const WindGB::StateHashLog& b) {
+    const auto divergence = WindGB::StateHashLog::compare(a, b);
+    if (!divergence) {
+        std::cout << "States identical over " << a.get_entries().size() << " frames" << std::endl;
+        return false;
+    }
+
+    std::cout << "States diverge at frame " << divergence->frame;
+    if (divergence->fields.empty()) {
+        std::cout << ", one run stopped earlier";
+    } else {
+        std::cout << " in";
+        for (const WindGB::StateField field : divergence->fields) std::cout << " " << WindGB::state_field_name(field);
+    }
+    std::cout << std::endl;
+    return true;
+}
+
+// Runs the emulator without a window nor speed limit, to replay movies, check determinism or benchmark ROMs
+int main(int argc, char** argv) {
+    RunOptions options;
+    std::string ppu_engine;
+    std::string verify_ppu_engine;
+    std::string state_log_path;
+    std::string compare_path;
+    std::string profile_path;
+    std::string symbols_path;
+    std::string memory_stats_prefix;
+    bool print_counters = false;
+    bool print_hardware_counters = false;
+
+    argparse::ArgumentParser parser("windgb_headless", "0.1.0");
+    parser.add_argument("rom_path").help("Path to the ROM to load into the emulator.").store_into(options.rom_path);
+    parser.add_argument("--movie").help("Replay a movie recorded with 'windgb --record-movie' and check its checkpoints.").store_into(options.movie_path);
+    parser.add_argument("--frames")
+        .help("Number of frames to run when no movie is given.")
+        .default_value(uint64_t{600})
+        .scan<'u', uint64_t>()
+        .store_into(options.frames);
+    parser.add_argument("--boot-rom").help("Boot ROM to run instead of the embedded one.").store_into(options.boot_rom_path);
+    parser.add_argument("--skip-boot")
+        .help("Start at the cartridge entry point in the post-boot state. Movies start the way they were recorded.")
+        .flag()
+        .store_into(options.skip_boot);
+    parser.add_argument("--ppu").help("PPU engine, 'scanline' or 'fifo'.").default_value(std::string("scanline")).choices("scanline", "fifo").store_into(ppu_engine);
+    parser.add_argument("--state-log").help("Write the machine state hashes of every frame into a file.").store_into(state_log_path);
+    parser.add_argument("--compare").help("Compare the state hashes of the run with a file written by --state-log.").store_into(compare_path);
+    parser.add_argument("--verify")
+        .help("Run a second time, with the given PPU engine, and compare the state hashes of both runs.")
+        .choices("scanline", "fifo")
+        .store_into(verify_ppu_engine);
+    parser.add_argument("--profile").help("Profile the guest code and write its call stacks in the collapsed flame graph format.").store_into(profile_path);
+    parser.add_argument("--symbols").help("RGBDS symbol file naming the functions of the profile.").store_into(symbols_path);
+    parser.add_argument("--memory-stats")
+        .help("Write the bus accesses per region, page and IO register into <prefix>.csv and .json, and a <prefix>.ppm heatmap.")
+        .store_into(memory_stats_prefix);
+    parser.add_argument("--counters").help("Print the emulation event counters of the run.").flag().store_into(print_counters);
+    parser.add_argument("--hw-counters")
+        .help("Print the host CPU cycles, instructions, branch and cache misses of the emulation loop (Linux perf events).")
+        .flag()
+        .store_into(print_hardware_counters);
+
+    try {
+        parser.parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        std::cerr << parser;
+        exit(EXIT_FAILURE);
+    }
+
+    WindGB::Logger::init();
+
+    const bool log_states = !state_log_path.empty() || !compare_path.empty() || !verify_ppu_engine.empty();
+    WindGB::StateHashLog state_log;
+
+    WindGB::Profiler profiler;
+    if (!symbols_path.empty()) {
+        profiler.set_symbols(WindGB::SymbolTable::load(symbols_path));
+    }
+
+    std::unique_ptr<WindGB::HardwareCounters> hardware_counters;
+    if (print_hardware_counters) {
+        hardware_counters = std::make_unique<WindGB::HardwareCounters>();
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+    const RunResult result = run(options, parse_ppu_engine(ppu_engine), log_states ? &state_log : nullptr, profile_path.empty() ? nullptr : &profiler,
+                                 memory_stats_prefix, hardware_counters.get());
+    const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+
+    const double emulated = static_cast<double>(result.ticks) * 4 / 4194304.0;
+    std::cout << result.frames << " frames, " << emulated << " s emulated in " << elapsed << " s (" << emulated / elapsed << "x real time)" << std::endl;
+    std::cout << "Last frame hash: " << std::hex << result.frame_hash << std::dec << std::endl;
+    if (print_counters) {
+        std::cout << WindGB::format_counters(result.counters);
+    }
+    if (hardware_counters) {
+        if (hardware_counters->any_available()) {
+            std::cout << WindGB::format_hardware_counters(*hardware_counters, result.frames, result.counters.instructions);
+        }
+        if (!hardware_counters->get_error().empty()) {
+            std::cerr << "Some hardware counters are unavailable (" << hardware_counters->get_error() << ")" << std::endl;
+        }
+    }
+
+    if (!profile_path.empty()) {
+        profiler.write_collapsed(profile_path);
+
+        const std::vector<WindGB::ProfileEntry> functions = profiler.get_functions();
+        for (size_t i = 0; i < std::min<size_t>(functions.size(), 10); i++) {
+            const double share = 100.0 * static_cast<double>(functions[i].cycles) / static_cast<double>(profiler.get_total_cycles());
+            std::cout << std::fixed << std::setprecision(2) << std::setw(6) << share << "%  " << functions[i].name << std::defaultfloat << std::endl;
+        }
+    }
+
+    bool failed = result.checkpoint_mismatch;
+    if (!state_log_path.empty()) {
+        state_log.save(state_log_path);
+    }
+    if (!compare_path.empty()) {
+        failed |= report_divergence(WindGB::StateHashLog::load(compare_path), state_log);
+    }
+    if (!verify_ppu_engine.empty()) {
+        WindGB::StateHashLog verify_log;
+        run(options, parse_ppu_engine(verify_ppu_engine), &verify_log);
+        failed |= report_divergence(state_log, verify_log);
+    }
+
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
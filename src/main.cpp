@@ -1,6 +1,9 @@
 #include <SFML/Graphics.hpp>
 #include <argparse/argparse.hpp>
 #include <cstdint>
+#include <fstream>
+#include <memory>
+#include <optional>
 #include <thread>
 
 #include "common.hpp"
@@ -26,11 +29,94 @@ void update_viewport(sf::RenderWindow& window, sf::View& fixed_view) {
     window.setView(fixed_view);
 }
 
+struct InputEvent {
+    WindGB::JoypadButton button;
+    bool pressed;
+};
+
+std::optional<WindGB::JoypadButton> map_key(const sf::Keyboard::Key key) {
+    switch (key) {
+        case sf::Keyboard::Key::Right:
+            return WindGB::JoypadButton::RIGHT;
+        case sf::Keyboard::Key::Left:
+            return WindGB::JoypadButton::LEFT;
+        case sf::Keyboard::Key::Up:
+            return WindGB::JoypadButton::UP;
+        case sf::Keyboard::Key::Down:
+            return WindGB::JoypadButton::DOWN;
+        case sf::Keyboard::Key::Z:
+            return WindGB::JoypadButton::A;
+        case sf::Keyboard::Key::X:
+            return WindGB::JoypadButton::B;
+        case sf::Keyboard::Key::Enter:
+            return WindGB::JoypadButton::START;
+        case sf::Keyboard::Key::Backspace:
+            return WindGB::JoypadButton::SELECT;
+        default:
+            return std::nullopt;
+    }
+}
+
+WindGB::PPU::Engine parse_ppu_engine(const std::string& name) {
+    if (name == "scanline") return WindGB::PPU::Engine::SCANLINE;
+    if (name == "fifo") return WindGB::PPU::Engine::FIFO;
+    throw std::runtime_error("Unknown PPU engine '" + name + "'");
+}
+
+// The config file holds one '<engine> <ROM title>' entry per line, '#' starts a comment
+std::optional<WindGB::PPU::Engine> find_rom_ppu_engine(const std::string& config_path, const std::string& title) {
+    std::ifstream file(config_path);
+    if (!file) {
+        throw std::runtime_error("Unable to open the PPU config '" + config_path + "'");
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        const size_t sep = line.find(' ');
+        if (sep == std::string::npos) continue;
+        if (line.substr(sep + 1) == title) {
+            return parse_ppu_engine(line.substr(0, sep));
+        }
+    }
+    return std::nullopt;
+}
+
 int main(int argc, char** argv) {
     std::string rom_path;
+    std::string ppu_engine;
+    std::string ppu_config;
+    std::string record_path;
+    std::string export_path;
+    std::string movie_path;
+    std::string trace_path;
+    std::string boot_rom_path;
+    bool skip_boot = false;
+    uint32_t checkpoint_interval = 60;
 
     argparse::ArgumentParser parser("windgb", "0.1.0");
     parser.add_argument("rom_path").help("Path to the ROM to load into the emulator.").store_into(rom_path);
+    parser.add_argument("--ppu")
+        .help("PPU engine, 'scanline' (fast) or 'fifo' (accurate, for raster effects).")
+        .default_value(std::string("scanline"))
+        .choices("scanline", "fifo")
+        .store_into(ppu_engine);
+    parser.add_argument("--boot-rom").help("Boot ROM to run instead of the embedded one.").store_into(boot_rom_path);
+    parser.add_argument("--skip-boot").help("Start at the cartridge entry point in the post-boot state.").flag().store_into(skip_boot);
+    parser.add_argument("--ppu-config").help("File selecting the PPU engine per ROM title, overridden by --ppu.").store_into(ppu_config);
+    parser.add_argument("--record").help("Record the presented frames into a compressed video stream.").store_into(record_path);
+    parser.add_argument("--export")
+        .help("Convert the --record stream on exit, into a YUV4MPEG2 video when the path ends with .y4m, a directory of PNG files otherwise.")
+        .store_into(export_path);
+    parser.add_argument("--record-movie").help("Record the joypad inputs into a movie, replayed by windgb_headless.").store_into(movie_path);
+    parser.add_argument("--checkpoint-interval")
+        .help("Frames between two frame hash checkpoints of the movie, 0 to disable.")
+        .default_value(checkpoint_interval)
+        .scan<'u', uint32_t>()
+        .store_into(checkpoint_interval);
+    parser.add_argument("--trace")
+        .help("Record the emulation and window threads into a Chrome trace JSON file, opened by ui.perfetto.dev or chrome://tracing.")
+        .store_into(trace_path);
 
     try {
         parser.parse_args(argc, argv);
@@ -49,110 +135,118 @@ int main(int argc, char** argv) {
     window.setView(fixed_view);
 
     WindGB::Logger::init();
+    WindGB::Tracer::set_thread_name("Window");
+    if (!trace_path.empty()) {
+        WindGB::Tracer::start();
+    }
 
     WindGB::Cartridge cart;
     WindGB::GameBoy gameboy;
 
+    const WindGB::BootMode boot_mode = skip_boot ? WindGB::BootMode::SKIP : WindGB::BootMode::BOOT_ROM;
     cart.load(rom_path);
     gameboy.insert(&cart);
-    gameboy.init();
+    if (!boot_rom_path.empty()) {
+        gameboy.set_boot_rom(WindGB::load_boot_rom(boot_rom_path));
+    }
+    gameboy.init(boot_mode);
+
+    auto engine = parse_ppu_engine(ppu_engine);
+    if (!ppu_config.empty() && !parser.is_used("--ppu")) {
+        engine = find_rom_ppu_engine(ppu_config, cart.get_title()).value_or(engine);
+    }
+    gameboy.get_ppu().set_engine(engine);
+
+    std::unique_ptr<WindGB::VideoRecorder> recorder;
+    if (!record_path.empty()) {
+        recorder = std::make_unique<WindGB::VideoRecorder>(record_path, gameboy.get_ppu().get_palette());
+        gameboy.get_ppu().set_recorder(recorder.get());
+    }
+
+    std::unique_ptr<WindGB::MovieWriter> movie;
+    if (!movie_path.empty()) {
+        movie = std::make_unique<WindGB::MovieWriter>(movie_path, cart.get_rom_hash(), boot_mode);
+    }
+
+    WindGB::SpscQueue<InputEvent, 64> input_queue;
 
     std::thread emu_thread([&]() {
+        WindGB::Tracer::set_thread_name("Emulation");
+        const WindGB::GameBoy::Session session(gameboy);
         uint64_t cycles_acc = 0;
         const auto start_time = std::chrono::high_resolution_clock::now();
         constexpr auto mcycle_duration = std::chrono::nanoseconds(952);
+        uint8_t buttons = 0;
+        uint64_t frame_count = 0;
+        uint64_t slice_start = WindGB::Tracer::now();  // Instructions run since the last sleep
 
         while (running) {
+            InputEvent input;
+            bool input_changed = false;
+            while (input_queue.pop(input)) {
+                const uint8_t mask = 1 << static_cast<int>(input.button);
+                buttons = input.pressed ? buttons | mask : buttons & ~mask;
+                input_changed = true;
+            }
+            if (input_changed) {
+                gameboy.get_joypad().set_buttons(buttons);
+                if (movie) movie->write_input(gameboy.get_tick(), buttons);
+            }
+
             cycles_acc += gameboy.step();
 
+            if (gameboy.get_ppu().get_frame_count() != frame_count) {
+                frame_count = gameboy.get_ppu().get_frame_count();
+                if (movie && checkpoint_interval > 0 && frame_count % checkpoint_interval == 0) {
+                    movie->write_checkpoint(gameboy.get_tick(), frame_count, gameboy.get_frame_hash());
+                }
+            }
+
             auto target_duration = cycles_acc * mcycle_duration;
 
             if (auto elapsed = std::chrono::high_resolution_clock::now() - start_time; elapsed < target_duration) {
+                if (WindGB::Tracer::is_enabled()) WindGB::Tracer::record("Run CPU", slice_start, WindGB::Tracer::now());
                 std::this_thread::sleep_for(target_duration - elapsed);
+                slice_start = WindGB::Tracer::now();
             }
         }
     });
 
     update_viewport(window, fixed_view);
 
+    uint64_t displayed_frame_hash = 0;
     while (window.isOpen()) {
-        while (const std::optional event = window.pollEvent()) {
-            if (event->is<sf::Event::Closed>()) {
-                running = false;
-                window.close();
-            }
-            if (event->is<sf::Event::Resized>()) {
-                update_viewport(window, fixed_view);
-            }
-            if (event->is<sf::Event::KeyPressed>()) {
-                auto joypad = gameboy.get_io().get_joypad();
-                switch (event->getIf<sf::Event::KeyPressed>()->code) {
-                    case sf::Keyboard::Key::Right:
-                        joypad->set_button(WindGB::JoypadButton::RIGHT, true);
-                        break;
-                    case sf::Keyboard::Key::Left:
-                        joypad->set_button(WindGB::JoypadButton::LEFT, true);
-                        break;
-                    case sf::Keyboard::Key::Up:
-                        joypad->set_button(WindGB::JoypadButton::UP, true);
-                        break;
-                    case sf::Keyboard::Key::Down:
-                        joypad->set_button(WindGB::JoypadButton::DOWN, true);
-                        break;
-                    case sf::Keyboard::Key::Z:
-                        joypad->set_button(WindGB::JoypadButton::A, true);
-                        break;
-                    case sf::Keyboard::Key::X:
-                        joypad->set_button(WindGB::JoypadButton::B, true);
-                        break;
-                    case sf::Keyboard::Key::Enter:
-                        joypad->set_button(WindGB::JoypadButton::START, true);
-                        break;
-                    case sf::Keyboard::Key::Backspace:
-                        joypad->set_button(WindGB::JoypadButton::SELECT, true);
-                        break;
-                    default:
-                        break;
+        {
+            TRACE_SCOPE("Poll events");
+            while (const std::optional event = window.pollEvent()) {
+                if (event->is<sf::Event::Closed>()) {
+                    running = false;
+                    window.close();
                 }
-            }
-
-            if (event->is<sf::Event::KeyReleased>()) {
-                auto joypad = gameboy.get_io().get_joypad();
-                switch (event->getIf<sf::Event::KeyReleased>()->code) {
-                    case sf::Keyboard::Key::Right:
-                        joypad->set_button(WindGB::JoypadButton::RIGHT, false);
-                        break;
-                    case sf::Keyboard::Key::Left:
-                        joypad->set_button(WindGB::JoypadButton::LEFT, false);
-                        break;
-                    case sf::Keyboard::Key::Up:
-                        joypad->set_button(WindGB::JoypadButton::UP, false);
-                        break;
-                    case sf::Keyboard::Key::Down:
-                        joypad->set_button(WindGB::JoypadButton::DOWN, false);
-                        break;
-                    case sf::Keyboard::Key::Z:
-                        joypad->set_button(WindGB::JoypadButton::A, false);
-                        break;
-                    case sf::Keyboard::Key::X:
-                        joypad->set_button(WindGB::JoypadButton::B, false);
-                        break;
-                    case sf::Keyboard::Key::Enter:
-                        joypad->set_button(WindGB::JoypadButton::START, false);
-                        break;
-                    case sf::Keyboard::Key::Backspace:
-                        joypad->set_button(WindGB::JoypadButton::SELECT, false);
-                        break;
-                    default:
-                        break;
+                if (event->is<sf::Event::Resized>()) {
+                    update_viewport(window, fixed_view);
+                }
+                // Inputs are applied by the emulation thread between two instructions, so that they can be recorded and replayed
+                if (const auto* key = event->getIf<sf::Event::KeyPressed>()) {
+                    if (const auto button = map_key(key->code)) input_queue.push({*button, true});
+                }
+                if (const auto* key = event->getIf<sf::Event::KeyReleased>()) {
+                    if (const auto button = map_key(key->code)) input_queue.push({*button, false});
                 }
             }
         }
 
         if (gameboy.get_ppu().is_frame_ready()) {
-            screen_texture.update(reinterpret_cast<const uint8_t*>(gameboy.get_ppu().get_framebuffer()));
+            // Only upload frames that differ from the one on screen, the hash and the buffer are read together
+            const WindGB::PresentedFrame frame = gameboy.get_ppu().get_presented_frame();
+            if (frame.hash != displayed_frame_hash) {
+                TRACE_SCOPE("Upload texture");
+                screen_texture.update(reinterpret_cast<const uint8_t*>(gameboy.get_ppu().get_framebuffer(frame)));
+                displayed_frame_hash = frame.hash;
+            }
             gameboy.get_ppu().mark_frame_consumed();
 
+            TRACE_SCOPE("Display");  // Waits for the frame rate limit
             window.clear(sf::Color::Black);
             window.draw(screen_sprite);
             window.display();
@@ -161,5 +255,27 @@ int main(int argc, char** argv) {
 
     running = false;
     if (emu_thread.joinable()) emu_thread.join();
+
+    if (movie) {
+        movie->finish(gameboy.get_tick());
+    }
+
+    if (recorder) {
+        gameboy.get_ppu().set_recorder(nullptr);
+        recorder->stop();
+        if (!export_path.empty()) {
+            if (export_path.ends_with(".y4m")) {
+                WindGB::export_y4m(record_path, export_path);
+            } else {
+                WindGB::export_png_sequence(record_path, export_path);
+            }
+        }
+    }
+
+    // Once every traced thread is stopped
+    if (!trace_path.empty()) {
+        WindGB::Tracer::stop();
+        WindGB::Tracer::write_chrome_json(trace_path);
+    }
     return 0;
 }
\ No newline at end of file
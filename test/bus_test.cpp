@@ -0,0 +1,26 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+// A debugger peeking at the timer registers must not bring the timer up to date, only the emulator side reads do
+TEST(Bus, PeekDoesNotSyncTimer) {
+    Cartridge cartridge;
+    const auto gameboy = std::make_unique<GameBoy>();  // Too large for the stack
+    cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+    gameboy->insert(&cartridge);
+    gameboy->init(BootMode::SKIP);
+    Bus& bus = gameboy->get_bus();
+
+    const uint8_t div = bus.direct_read(REG_DIV_ADDR);
+    bus.cycles(64);  // One DIV increment, TIMA is stopped so the timer has no event to sync on
+    EXPECT_EQ(bus.peek(REG_DIV_ADDR), div);
+    EXPECT_EQ(bus.direct_read(REG_DIV_ADDR), static_cast<uint8_t>(div + 1));
+}
+
+}  // namespace WindGB
@@ -0,0 +1,31 @@
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <string>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+// The history must reach stderr without a logger, as in a release build or a host that never calls Logger::init
+TEST(FlightRecorderDeathTest, InvalidOpcodeDumpsHistory) {
+    Cartridge cartridge;
+    const auto gameboy = std::make_unique<GameBoy>();  // Too large for the stack
+    cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+    gameboy->insert(&cartridge);
+    gameboy->init(BootMode::SKIP);
+
+    gameboy->get_bus().direct_write(WRAM_ADDR_START, 0x00);      // NOP
+    gameboy->get_bus().direct_write(WRAM_ADDR_START + 1, 0xD3);  // Invalid
+    gameboy->get_cpu().regs().PC = WRAM_ADDR_START;
+    EXPECT_EXIT(
+        {
+            gameboy->step();
+            gameboy->step();
+        },
+        testing::ExitedWithCode(EXIT_FAILURE), "Last executed instructions(.|\n)*C000(.|\n)*C001");
+}
+
+}  // namespace WindGB
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+static void run_frames(GameBoy& gameboy, const uint64_t frames) {
+    const uint64_t target = gameboy.get_ppu().get_frame_count() + frames;
+    while (gameboy.get_ppu().get_frame_count() < target) gameboy.step();
+}
+
+// Hash and pixels of the last presented frame
+static std::pair<uint64_t, std::vector<uint32_t>> presented_frame(GameBoy& gameboy) {
+    const PresentedFrame frame = gameboy.get_ppu().get_presented_frame();
+    const uint32_t* pixels = gameboy.get_ppu().get_framebuffer(frame);
+    return {frame.hash, std::vector<uint32_t>(pixels, pixels + SCREEN_WIDTH * SCREEN_HEIGHT)};
+}
+
+// Machine halfway through the 60th frame of a ROM drawing text on the background
+static std::unique_ptr<GameBoy> make_running_machine(Cartridge& cartridge) {
+    auto gameboy = std::make_unique<GameBoy>();  // Too large for the stack
+    cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+    gameboy->insert(&cartridge);
+    gameboy->init(BootMode::SKIP);
+    run_frames(*gameboy, 60);
+    while (gameboy->get_bus().direct_read(REG_LY_ADDR) != 72) gameboy->step();
+    return gameboy;
+}
+
+// A clone does not take the screen, it must redraw every line even where the copied PPU state says they are up to date
+TEST(GameBoyClone, RedrawsScreen) {
+    Cartridge cartridge;
+    const auto source = make_running_machine(cartridge);
+
+    const auto clone = std::make_unique<GameBoy>(*source);
+    run_frames(*source, 2);
+    run_frames(*clone, 2);
+
+    EXPECT_EQ(presented_frame(*source), presented_frame(*clone));
+}
+
+// The tile maps rewritten after the save are drawn into the PPU caches, the restore must bring the cached rows back with VRAM
+TEST(GameBoySnapshot, RestoreRedrawsChangedRows) {
+    Cartridge cartridge;
+    const auto gameboy = make_running_machine(cartridge);
+    Snapshot snapshot;
+    (void)gameboy->save_snapshot(snapshot);
+    run_frames(*gameboy, 2);
+    const auto expected = presented_frame(*gameboy);
+
+    for (uint16_t addr = TILE_MAP_0; addr <= VRAM_ADDR_END; addr++) gameboy->get_bus().direct_write(addr, 0x7F);
+    run_frames(*gameboy, 2);
+    ASSERT_NE(presented_frame(*gameboy), expected);
+    (void)gameboy->restore_snapshot(snapshot);
+    run_frames(*gameboy, 2);
+    EXPECT_EQ(presented_frame(*gameboy), expected);
+}
+
+// The pages differing from a snapshot of another instance are unknown, every cached row must be redrawn
+TEST(GameBoySnapshot, RestoreIntoAnotherMachine) {
+    Cartridge cartridge;
+    const auto gameboy = make_running_machine(cartridge);
+    Snapshot snapshot;
+    (void)gameboy->save_snapshot(snapshot);
+    run_frames(*gameboy, 2);
+
+    Cartridge other_cartridge;
+    const auto other = make_running_machine(other_cartridge);
+    for (uint16_t addr = TILE_MAP_0; addr <= VRAM_ADDR_END; addr++) other->get_bus().direct_write(addr, 0x7F);
+    run_frames(*other, 2);
+    (void)other->restore_snapshot(snapshot);
+    run_frames(*other, 2);
+    EXPECT_EQ(presented_frame(*other), presented_frame(*gameboy));
+}
+
+}  // namespace WindGB
@@ -0,0 +1,30 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+// Releasing several buttons at once raises the joypad interrupt, as a movie or an input script does
+TEST(Joypad, SetButtonsRaisesInterruptOnRelease) {
+    Cartridge cartridge;
+    const auto gameboy = std::make_unique<GameBoy>();  // Too large for the stack
+    cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+    gameboy->insert(&cartridge);
+    gameboy->init(BootMode::SKIP);
+    Bus& bus = gameboy->get_bus();
+
+    bus.direct_write(0xFF00, 0x10);  // Select the buttons
+    gameboy->get_joypad().set_buttons(1 << static_cast<int>(JoypadButton::A) | 1 << static_cast<int>(JoypadButton::B));
+    bus.cycles(1);
+    bus.direct_write(REG_IF_ADDR, 0x00);
+
+    gameboy->get_joypad().set_buttons(0);
+    bus.cycles(1);
+    EXPECT_TRUE(bus.direct_read(REG_IF_ADDR) & (1 << 4));
+}
+
+}  // namespace WindGB
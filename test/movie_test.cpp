@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "windgb.hpp"
+
+namespace WindGB {
+
+static constexpr uint64_t ROM_HASH = 0x0123456789ABCDEF;
+
+static std::string movie_path(const std::string& name) { return (std::filesystem::temp_directory_path() / name).string(); }
+
+// Tick deltas, frame counts and hashes spanning one to ten LEB128 bytes
+static void write_movie(const std::string& path) {
+    MovieWriter writer(path, ROM_HASH, BootMode::SKIP);
+    writer.write_input(5, 0x81);
+    writer.write_input(5, 0x00);
+    writer.write_checkpoint(5 + 200000, 1 << 20, 0xFEDCBA9876543210);
+    writer.write_checkpoint(UINT64_MAX, UINT64_MAX, 0);
+    writer.finish(UINT64_MAX);
+}
+
+TEST(Movie, RoundTrip) {
+    const std::string path = movie_path("windgb_movie_test.wgbm");
+    write_movie(path);
+
+    MovieReader reader(path);
+    EXPECT_EQ(reader.get_rom_hash(), ROM_HASH);
+    EXPECT_EQ(reader.get_start(), BootMode::SKIP);
+
+    MovieRecord record;
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, MovieRecord::Type::INPUT);
+    EXPECT_EQ(record.tick, 5u);
+    EXPECT_EQ(record.buttons, 0x81);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, MovieRecord::Type::INPUT);
+    EXPECT_EQ(record.tick, 5u);
+    EXPECT_EQ(record.buttons, 0x00);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, MovieRecord::Type::CHECKPOINT);
+    EXPECT_EQ(record.tick, 200005u);
+    EXPECT_EQ(record.frame, 1u << 20);
+    EXPECT_EQ(record.frame_hash, 0xFEDCBA9876543210);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, MovieRecord::Type::CHECKPOINT);
+    EXPECT_EQ(record.tick, UINT64_MAX);
+    EXPECT_EQ(record.frame, UINT64_MAX);
+    EXPECT_EQ(record.frame_hash, 0u);
+    ASSERT_TRUE(reader.next(record));
+    EXPECT_EQ(record.type, MovieRecord::Type::END);
+    EXPECT_EQ(record.tick, UINT64_MAX);
+    EXPECT_FALSE(reader.next(record));
+    std::filesystem::remove(path);
+}
+
+// A recording interrupted between records ends quietly, one cut inside a record is an error
+TEST(Movie, Truncated) {
+    const std::string path = movie_path("windgb_movie_truncated_test.wgbm");
+    write_movie(path);
+    const uintmax_t size = std::filesystem::file_size(path);
+    MovieRecord record;
+
+    std::filesystem::resize_file(path, size - 2);  // Without the END record
+    MovieReader interrupted(path);
+    int records = 0;
+    while (interrupted.next(record)) records++;
+    EXPECT_EQ(records, 4);
+
+    std::filesystem::resize_file(path, size - 3);  // Inside the last checkpoint hash
+    MovieReader cut(path);
+    EXPECT_THROW(
+        {
+            while (cut.next(record)) {
+            }
+        },
+        std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+}  // namespace WindGB
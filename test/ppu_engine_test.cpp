@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+// Runs the ROM from the post-boot state with the given engine and returns the hash of every presented frame
+static std::vector<uint64_t> frame_hashes(const std::string& rom, const PPU::Engine engine, const uint64_t frames) {
+    Cartridge cartridge;
+    const auto gameboy = std::make_unique<GameBoy>();  // Too large for the stack
+    cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/" + rom);
+    gameboy->insert(&cartridge);
+    gameboy->init(BootMode::SKIP);
+    gameboy->get_ppu().set_engine(engine);
+
+    std::vector<uint64_t> hashes;
+    while (hashes.size() < frames) {
+        gameboy->step();
+        if (gameboy->get_ppu().get_frame_count() > hashes.size()) hashes.push_back(gameboy->get_frame_hash());
+    }
+    return hashes;
+}
+
+// The ROM only draws text on the background and never writes the LCD registers in the middle of a line: both engines
+// must draw the same frames
+TEST(PPUEngine, FifoMatchesScanline) {
+    const std::string rom = "blargg/cpu_instrs/individual/01-special.gb";
+    const std::vector<uint64_t> scanline = frame_hashes(rom, PPU::Engine::SCANLINE, 300);
+    const std::vector<uint64_t> fifo = frame_hashes(rom, PPU::Engine::FIFO, 300);
+
+    for (size_t frame = 0; frame < scanline.size(); frame++) {
+        ASSERT_EQ(scanline[frame], fifo[frame]) << "Frames differ at frame " << frame + 1;
+    }
+}
+
+// The sprites and the fine scroll lengthen mode 3 with the FIFO engine only, the state hashes compared by
+// windgb_headless --verify must not tell the engines apart for it
+TEST(PPUEngine, StateHashIgnoresModeThreeLength) {
+    StateHashes hashes[2];
+    for (const PPU::Engine engine : {PPU::Engine::SCANLINE, PPU::Engine::FIFO}) {
+        Cartridge cartridge;
+        const auto gameboy = std::make_unique<GameBoy>();
+        cartridge.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+        gameboy->insert(&cartridge);
+        gameboy->init(BootMode::SKIP);
+        gameboy->get_ppu().set_engine(engine);
+
+        // The CPU never runs, the PPU is driven by bus cycles
+        Bus& bus = gameboy->get_bus();
+        bus.direct_write(REG_SCX_ADDR, 3);
+        bus.direct_write(OAM_ADDR_START, 16);
+        bus.direct_write(OAM_ADDR_START + 1, 8);
+        while (gameboy->get_ppu().get_frame_count() < 2) bus.cycles(1);
+        hashes[static_cast<int>(engine)] = gameboy->hash_state();
+    }
+
+    EXPECT_EQ(hashes[0][StateField::PPU], hashes[1][StateField::PPU]);
+}
+
+}  // namespace WindGB
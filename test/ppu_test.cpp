@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common.hpp"
+#include "windgb.hpp"
+
+namespace WindGB {
+
+// Machine whose PPU is only driven by bus cycles, the CPU never runs
+class PPUTest : public ::testing::Test {
+   protected:
+    Cartridge cartridge_;
+    std::unique_ptr<GameBoy> gameboy_ = std::make_unique<GameBoy>();  // Too large for the stack
+
+    void SetUp() override {
+        cartridge_.load(std::string(WINDGB_TEST_ROM_DIR) + "/blargg/cpu_instrs/individual/01-special.gb");
+        gameboy_->insert(&cartridge_);
+        gameboy_->init(BootMode::SKIP);
+    }
+
+    void write(const uint16_t addr, const uint8_t data) { gameboy_->get_bus().direct_write(addr, data); }
+
+    void run_frames(const uint64_t frames) {
+        const uint64_t target = gameboy_->get_ppu().get_frame_count() + frames;
+        while (gameboy_->get_ppu().get_frame_count() < target) gameboy_->get_bus().cycles(1);
+    }
+};
+
+TEST_F(PPUTest, SpriteTileRewriteRedrawsLinesWithBackgroundOff) {
+    write(REG_LCDC_ADDR, 0x82);  // LCD and OBJ on, BG off
+    write(REG_OBP0_ADDR, 0xE4);
+    write(OAM_ADDR_START, 16);  // Sprite 0 in the top left corner, tile 1
+    write(OAM_ADDR_START + 1, 8);
+    write(OAM_ADDR_START + 2, 1);
+    write(OAM_ADDR_START + 3, 0);
+    for (uint16_t addr = 0x8010; addr < 0x8020; addr++) write(addr, 0xFF);
+    run_frames(2);  // Both buffers drawn
+    const uint64_t before = gameboy_->get_frame_hash();
+
+    for (uint16_t addr = 0x8010; addr < 0x8020; addr++) write(addr, 0x0F);
+    run_frames(2);
+    EXPECT_NE(gameboy_->get_frame_hash(), before);
+}
+
+}  // namespace WindGB
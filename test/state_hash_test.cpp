@@ -0,0 +1,49 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+
+#include "windgb.hpp"
+
+namespace WindGB {
+
+static std::string log_path(const std::string& name) { return (std::filesystem::temp_directory_path() / name).string(); }
+
+static StateHashLog make_log() {
+    StateHashLog log;
+    for (uint64_t frame = 1; frame <= 3; frame++) {
+        StateHashes hashes;
+        hashes.frame = frame;
+        for (size_t i = 0; i < STATE_FIELD_COUNT; i++) hashes.fields[i] = (frame << 56) ^ (i * 0x9E3779B97F4A7C15);
+        log.record(hashes);
+    }
+    return log;
+}
+
+TEST(StateHashLog, RoundTrip) {
+    const StateHashLog log = make_log();
+    const std::string path = log_path("windgb_state_hash_test.wgbs");
+    log.save(path);
+
+    const StateHashLog loaded = StateHashLog::load(path);
+    ASSERT_EQ(loaded.get_entries().size(), log.get_entries().size());
+    for (size_t i = 0; i < log.get_entries().size(); i++) {
+        EXPECT_EQ(loaded.get_entries()[i].frame, log.get_entries()[i].frame);
+        EXPECT_EQ(loaded.get_entries()[i].fields, log.get_entries()[i].fields);
+    }
+    EXPECT_FALSE(StateHashLog::compare(log, loaded));
+    std::filesystem::remove(path);
+}
+
+TEST(StateHashLog, TruncatedEntryThrows) {
+    const std::string path = log_path("windgb_state_hash_truncated_test.wgbs");
+    make_log().save(path);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    EXPECT_THROW((void)StateHashLog::load(path), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+}  // namespace WindGB
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "windgb.hpp"
+
+namespace WindGB {
+
+static const Palette PALETTE = {0xFFFFFFFF, 0xAAAAAAFF, 0x555555FF, 0x000000FF};
+
+static std::string stream_path(const std::string& name) { return (std::filesystem::temp_directory_path() / name).string(); }
+
+static void record(const std::string& path, const std::vector<ShadeFrame>& frames) {
+    VideoRecorder recorder(path, PALETTE);
+    for (const ShadeFrame& frame : frames) recorder.push_frame(frame.data());
+    recorder.stop();
+    ASSERT_EQ(recorder.get_dropped_frames(), 0u);
+}
+
+// Blank first lines, runs longer than 64 pixels in every shade, then a frame left unchanged and one changing a single line
+TEST(VideoStream, RoundTrip) {
+    std::vector<ShadeFrame> frames(4);
+    for (int y = 40; y < SCREEN_HEIGHT; y++) {
+        for (int x = 0; x < SCREEN_WIDTH; x++) frames[0][y * SCREEN_WIDTH + x] = (x < 100 ? y : x + y) % 4;
+    }
+    frames[1] = frames[0];
+    frames[2] = frames[0];
+    frames[3] = frames[0];
+    frames[3][SCREEN_WIDTH * 100 + 7] ^= 0x03;
+    const std::string path = stream_path("windgb_video_stream_test.wgbv");
+    record(path, frames);
+
+    VideoStreamReader reader(path);
+    EXPECT_EQ(reader.get_palette(), PALETTE);
+    ShadeFrame frame;
+    uint32_t number;
+    for (uint32_t i = 0; i < frames.size(); i++) {
+        ASSERT_TRUE(reader.next_frame(frame, number));
+        EXPECT_EQ(number, i);
+        EXPECT_EQ(frame, frames[i]);
+    }
+    EXPECT_FALSE(reader.next_frame(frame, number));
+    std::filesystem::remove(path);
+}
+
+TEST(VideoStream, TruncatedFrameThrows) {
+    std::vector<ShadeFrame> frames(1);
+    for (size_t i = 0; i < frames[0].size(); i++) frames[0][i] = i % 4;
+    const std::string path = stream_path("windgb_video_stream_truncated_test.wgbv");
+    record(path, frames);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    VideoStreamReader reader(path);
+    ShadeFrame frame;
+    uint32_t number;
+    EXPECT_THROW((void)reader.next_frame(frame, number), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+}  // namespace WindGB